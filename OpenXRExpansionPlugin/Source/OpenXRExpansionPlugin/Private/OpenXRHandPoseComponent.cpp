@@ -537,8 +537,12 @@ void FBPXRSkeletalRepContainer::CopyForReplication(FBPOpenXRActionSkeletalData&
 	if (!Other.bHasValidData)
 		return;
 
-	bAllowDeformingMesh = Other.bAllowDeformingMesh;
 	bEnableUE4HandRepSavings = Other.bEnableUE4HandRepSavings;
+	CompressionMode = Other.ReplicationCompression;
+	QuantizedRotationBits = (uint8)FMath::Clamp(Other.QuantizedRotationBits, 6, 16);
+
+	// The compressed modes only send rotations, the receiving end uses the bone lengths from its mesh
+	bAllowDeformingMesh = CompressionMode == EXRHandRepCompressionMode::OXR_HandRep_Rotators ? Other.bAllowDeformingMesh : false;
 
 	// Instead of doing this, we likely need to lerp but this is for testing
 	//SkeletalTransforms = Other.SkeletalData.SkeletalTransforms;
@@ -549,12 +553,12 @@ void FBPXRSkeletalRepContainer::CopyForReplication(FBPOpenXRActionSkeletalData&
 		return;
 	}
 
-	int32 BoneCountAdjustment = 5 + (bEnableUE4HandRepSavings ? 4 : 0);
+	const int32 RepBoneCount = GetReplicatedBoneCount(bEnableUE4HandRepSavings);
 
-	if (SkeletalTransforms.Num() != EHandKeypointCount - BoneCountAdjustment)
+	if (SkeletalTransforms.Num() != RepBoneCount)
 	{
-		SkeletalTransforms.Reset(EHandKeypointCount - BoneCountAdjustment); // Minus bones we don't need
-		SkeletalTransforms.AddUninitialized(EHandKeypointCount - BoneCountAdjustment);
+		SkeletalTransforms.Reset(RepBoneCount); // Minus bones we don't need
+		SkeletalTransforms.AddUninitialized(RepBoneCount);
 	}
 
 	int32 idx = 0;
@@ -600,8 +604,7 @@ void FBPXRSkeletalRepContainer::CopyForReplication(FBPOpenXRActionSkeletalData&
 
 void FBPXRSkeletalRepContainer::CopyReplicatedTo(const FBPXRSkeletalRepContainer& Container, FBPOpenXRActionSkeletalData& Other)
 {
-	int32 BoneCountAdjustment = 5 + (Container.bEnableUE4HandRepSavings ? 4 : 0);
-	if (Container.SkeletalTransforms.Num() < (EHandKeypointCount - BoneCountAdjustment))
+	if (Container.SkeletalTransforms.Num() < GetReplicatedBoneCount(Container.bEnableUE4HandRepSavings))
 	{
 		Other.SkeletalTransforms.Empty();
 		Other.bHasValidData = false;
@@ -688,9 +691,9 @@ bool FBPXRSkeletalRepContainer::NetSerialize(FArchive& Ar, class UPackageMap* Ma
 	Ar.SerializeBits(&TargetHand, 1);
 	Ar.SerializeBits(&bAllowDeformingMesh, 1);
 	Ar.SerializeBits(&bEnableUE4HandRepSavings, 1);
+	Ar.SerializeBits(&CompressionMode, 2);
 
-	int32 BoneCountAdjustment = 5 + (bEnableUE4HandRepSavings ? 4 : 0);
-	uint8 TransformCount = EHandKeypointCount - BoneCountAdjustment;
+	uint8 TransformCount = (uint8)GetReplicatedBoneCount(bEnableUE4HandRepSavings);
 
 	//Ar << TransformCount;
 
@@ -699,6 +702,17 @@ bool FBPXRSkeletalRepContainer::NetSerialize(FArchive& Ar, class UPackageMap* Ma
 		SkeletalTransforms.Reset(TransformCount);
 	}
 
+	if (CompressionMode != EXRHandRepCompressionMode::OXR_HandRep_Rotators)
+	{
+		// 6 - 16 bits
+		uint32 BitsOffset = Ar.IsSaving() ? (uint32)(FMath::Clamp<int32>(QuantizedRotationBits, 6, 16) - 6) : 0;
+		Ar.SerializeInt(BitsOffset, 16);
+		QuantizedRotationBits = (uint8)FMath::Clamp<int32>(BitsOffset + 6, 6, 16);
+
+		SerializeQuantized(Ar, TransformCount);
+		return bOutSuccess;
+	}
+
 	FVector Position = FVector::ZeroVector;
 	FRotator Rot = FRotator::ZeroRotator;
 
@@ -729,6 +743,162 @@ bool FBPXRSkeletalRepContainer::NetSerialize(FArchive& Ar, class UPackageMap* Ma
 	return bOutSuccess;
 }
 
+namespace OpenXRHandRep
+{
+	// Smallest three, the largest component is dropped and rebuilt from the others as the quat is unit length
+	// Quat is always replaced with the rebuilt value so that the sender sees the same rotation as the receiver
+	static void SerializeQuat(FArchive& Ar, FQuat& Quat, int32 Bits)
+	{
+		const float Range = UE_INV_SQRT_2;
+		const uint32 MaxValue = (1u << Bits) - 1;
+
+		uint32 LargestIndex = 0;
+		uint32 Packed[3] = { 0, 0, 0 };
+
+		if (Ar.IsSaving())
+		{
+			const FQuat Normalized = Quat.GetNormalized();
+			const float Components[4] = { (float)Normalized.X, (float)Normalized.Y, (float)Normalized.Z, (float)Normalized.W };
+
+			for (uint32 i = 1; i < 4; ++i)
+			{
+				if (FMath::Abs(Components[i]) > FMath::Abs(Components[LargestIndex]))
+					LargestIndex = i;
+			}
+
+			// Q and -Q are the same rotation, flip it so that the dropped component is positive
+			const float Sign = Components[LargestIndex] < 0.f ? -1.f : 1.f;
+
+			int32 PackedIndex = 0;
+			for (uint32 i = 0; i < 4; ++i)
+			{
+				if (i == LargestIndex)
+					continue;
+
+				const float Alpha = FMath::Clamp(((Components[i] * Sign) + Range) / (2.f * Range), 0.f, 1.f);
+				Packed[PackedIndex++] = (uint32)FMath::RoundToInt(Alpha * MaxValue);
+			}
+		}
+
+		Ar.SerializeInt(LargestIndex, 4);
+		for (int i = 0; i < 3; ++i)
+		{
+			Ar.SerializeInt(Packed[i], MaxValue + 1);
+		}
+
+		float Components[4];
+		float SumSquares = 0.f;
+		int32 PackedIndex = 0;
+		for (uint32 i = 0; i < 4; ++i)
+		{
+			if (i == LargestIndex)
+				continue;
+
+			Components[i] = (((float)Packed[PackedIndex++] / MaxValue) * 2.f * Range) - Range;
+			SumSquares += FMath::Square(Components[i]);
+		}
+
+		Components[LargestIndex] = FMath::Sqrt(FMath::Max(1.f - SumSquares, 0.f));
+		Quat = FQuat(Components[0], Components[1], Components[2], Components[3]).GetNormalized();
+	}
+
+	// Curl around the bones Y axis and optionally splay towards its Y, the roll is dropped
+	// Curl is stored as a full circle so that joints bending past 90 degrees don't flip
+	static void SerializeCurlSplay(FArchive& Ar, FQuat& Quat, bool bWithSplay)
+	{
+		uint8 Curl = 0;
+		uint8 Splay = 0;
+
+		if (Ar.IsSaving())
+		{
+			const FVector BoneDir = Quat.GetForwardVector();
+			Curl = FRotator::CompressAxisToByte(FMath::RadiansToDegrees(FMath::Atan2(BoneDir.Z, BoneDir.X)));
+
+			if (bWithSplay)
+			{
+				Splay = FRotator::CompressAxisToByte(FMath::RadiansToDegrees(FMath::Asin(FMath::Clamp(BoneDir.Y, -1.f, 1.f))));
+			}
+		}
+
+		Ar << Curl;
+		if (bWithSplay)
+		{
+			Ar << Splay;
+		}
+
+		float SinCurl, CosCurl, SinSplay, CosSplay;
+		FMath::SinCos(&SinCurl, &CosCurl, FMath::DegreesToRadians(FRotator::DecompressAxisFromByte(Curl)));
+		FMath::SinCos(&SinSplay, &CosSplay, FMath::DegreesToRadians(FRotator::DecompressAxisFromByte(Splay)));
+
+		const FVector BoneDir(CosSplay * CosCurl, SinSplay, CosSplay * SinCurl);
+		Quat = FQuat::FindBetweenNormals(FVector::ForwardVector, BoneDir.GetSafeNormal());
+	}
+}
+
+void FBPXRSkeletalRepContainer::SerializeQuantized(FArchive& Ar, int32 TransformCount)
+{
+	const int32 Bits = FMath::Clamp<int32>(QuantizedRotationBits, 6, 16);
+	const bool bUseCurlAndSplay = CompressionMode == EXRHandRepCompressionMode::OXR_HandRep_CurlAndSplay;
+
+	// Rebuilt component space rotations, the sender walks these too so that the error doesn't build up down each finger
+	TArray<FQuat, TInlineAllocator<20>> DecodedRotations;
+	DecodedRotations.SetNumUninitialized(TransformCount);
+
+	int32 idx = 0;
+	auto SerializeBone = [&](int32 ParentIndex, bool bCurl, bool bSplay)
+	{
+		const FQuat ParentRotation = ParentIndex == INDEX_NONE ? FQuat::Identity : DecodedRotations[ParentIndex];
+
+		FQuat LocalRotation = FQuat::Identity;
+		if (Ar.IsSaving() && SkeletalTransforms.IsValidIndex(idx))
+		{
+			LocalRotation = ParentRotation.Inverse() * SkeletalTransforms[idx].GetRotation();
+		}
+
+		if (bCurl)
+		{
+			OpenXRHandRep::SerializeCurlSplay(Ar, LocalRotation, bSplay);
+		}
+		else
+		{
+			OpenXRHandRep::SerializeQuat(Ar, LocalRotation, Bits);
+		}
+
+		DecodedRotations[idx] = ParentRotation * LocalRotation;
+
+		if (Ar.IsLoading())
+		{
+			SkeletalTransforms.Add(FTransform(DecodedRotations[idx]));
+		}
+
+		return idx++;
+	};
+
+	// Same ordering as CopyForReplication
+	const int32 WristIndex = SerializeBone(INDEX_NONE, false, false);
+
+	// Thumb moves too freely for curl and splay
+	int32 ParentIndex = WristIndex;
+	for (int i = 0; i < 3; ++i)
+	{
+		ParentIndex = SerializeBone(ParentIndex, false, false);
+	}
+
+	for (int Finger = 0; Finger < 4; ++Finger)
+	{
+		ParentIndex = WristIndex;
+
+		if (!bEnableUE4HandRepSavings)
+		{
+			ParentIndex = SerializeBone(ParentIndex, false, false); // Metacarpal
+		}
+
+		ParentIndex = SerializeBone(ParentIndex, bUseCurlAndSplay, true); // Proximal
+		ParentIndex = SerializeBone(ParentIndex, bUseCurlAndSplay, false); // Intermediate
+		SerializeBone(ParentIndex, bUseCurlAndSplay, false); // Distal
+	}
+}
+
 void UOpenXRAnimInstance::NativeBeginPlay()
 {
 	Super::NativeBeginPlay();
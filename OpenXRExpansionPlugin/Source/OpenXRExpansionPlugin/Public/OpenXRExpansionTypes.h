@@ -86,6 +86,16 @@ enum class EVROpenXRSkeletonType : uint8
 };
 
 
+UENUM(BlueprintType)
+enum class EXRHandRepCompressionMode : uint8
+{
+	// Full compressed rotators (and positions if deforming) for every bone
+	OXR_HandRep_Rotators,
+	// Bone local smallest three quaternions, rotations only with the bone lengths coming from the mesh
+	OXR_HandRep_QuantizedQuaternions,
+	// Same as the quantized quaternions, except finger joints only send curl (and splay at the knuckle)
+	OXR_HandRep_CurlAndSplay
+};
 
 USTRUCT(BlueprintType, Category = "VRExpansionFunctions|OpenXR|HandSkeleton")
 struct OPENXREXPANSIONPLUGIN_API FBPOpenXRActionSkeletalData
@@ -118,6 +128,15 @@ public:
 	UPROPERTY(EditAnywhere, NotReplicated, BlueprintReadWrite, Category = Default)
 		bool bEnableUE4HandRepSavings;
 
+	// How the skeletal transforms are compressed when replicating
+	// The quantized modes don't send positions so they override bAllowDeformingMesh on remote clients
+	UPROPERTY(EditAnywhere, NotReplicated, BlueprintReadWrite, Category = Default)
+		EXRHandRepCompressionMode ReplicationCompression;
+
+	// Bits per quaternion component for the quantized compression modes
+	UPROPERTY(EditAnywhere, NotReplicated, BlueprintReadWrite, Category = Default, meta = (ClampMin = "6", ClampMax = "16", UIMin = "6", UIMax = "16"))
+		int32 QuantizedRotationBits;
+
 	UPROPERTY(BlueprintReadOnly, NotReplicated, Transient, Category = Default)
 		TArray<FTransform> OldSkeletalTransforms;
 
@@ -141,6 +160,8 @@ public:
 		bAllowDeformingMesh = true;
 		bMirrorLeftRight = false;
 		bEnableUE4HandRepSavings = true;
+		ReplicationCompression = EXRHandRepCompressionMode::OXR_HandRep_Rotators;
+		QuantizedRotationBits = 10;
 		TargetHand = EVRSkeletalHandIndex::EActionHandIndex_Right;
 		bHasValidData = false;
 		LastHandGestureIndex = INDEX_NONE;
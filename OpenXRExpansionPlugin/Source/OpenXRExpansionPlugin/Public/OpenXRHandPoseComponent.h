@@ -36,6 +36,12 @@ public:
 	UPROPERTY(Transient, NotReplicated)
 		uint8 BoneCount;
 
+	UPROPERTY(Transient, NotReplicated)
+		EXRHandRepCompressionMode CompressionMode;
+
+	UPROPERTY(Transient, NotReplicated)
+		uint8 QuantizedRotationBits;
+
 
 	FBPXRSkeletalRepContainer()
 	{
@@ -43,6 +49,14 @@ public:
 		bAllowDeformingMesh = false;
 		bEnableUE4HandRepSavings = true;
 		BoneCount = 0;
+		CompressionMode = EXRHandRepCompressionMode::OXR_HandRep_Rotators;
+		QuantizedRotationBits = 10;
+	}
+
+	// Number of bones that actually get sent, wrist + thumb + the 4 fingers with or without their metacarpals
+	static int32 GetReplicatedBoneCount(bool bSkipMetacarpals)
+	{
+		return 4 + (4 * (bSkipMetacarpals ? 3 : 4));
 	}
 
 	bool bHasValidData()
@@ -54,6 +68,11 @@ public:
 	static void CopyReplicatedTo(const FBPXRSkeletalRepContainer& Container, FBPOpenXRActionSkeletalData& Other);
 
 	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+private:
+
+	// Serializes the rotations as bone local quantized values for the compressed modes
+	void SerializeQuantized(FArchive& Ar, int32 TransformCount);
 };
 
 template<>
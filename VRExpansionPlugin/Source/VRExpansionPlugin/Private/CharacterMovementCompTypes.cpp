@@ -20,6 +20,7 @@ FSavedMove_VRBaseCharacter::FSavedMove_VRBaseCharacter() : FSavedMove_Character(
 	LFDiff = FVector::ZeroVector;
 	VRCapsuleRotation = FRotator::ZeroRotator;
 	VRReplicatedMovementMode = EVRConjoinedMovementModes::C_MOVE_MAX;// _None;
+	RoomscalePathLength = 0.0f;
 }
 
 uint8 FSavedMove_VRBaseCharacter::GetCompressedFlags() const
@@ -61,12 +62,31 @@ bool FSavedMove_VRBaseCharacter::CanCombineWith(const FSavedMovePtr& NewMove, AC
 	if (!ConditionalValues.RequestedVelocity.IsZero() || !nMove->ConditionalValues.RequestedVelocity.IsZero())
 		return false;
 
-	// Hate this but we really can't combine if I am sending a new capsule height
-	if (!FMath::IsNearlyEqual(LFDiff.Z, nMove->LFDiff.Z))
-		return false;
+	UVRBaseCharacterMovementComponent* MoveComp = Character ? Cast<UVRBaseCharacterMovementComponent>(Character->GetCharacterMovement()) : nullptr;
 
-	if (!FVector2D(LFDiff.X, LFDiff.Y).IsZero() && !FVector2D(nMove->LFDiff.X, nMove->LFDiff.Y).IsZero() && !FVector::Coincident(LFDiff.GetSafeNormal2D(), nMove->LFDiff.GetSafeNormal2D(), AccelDotThresholdCombine))
-		return false;
+	if (MoveComp && MoveComp->bUseRoomscaleMoveCombining)
+	{
+		// The combined move is replayed with the newest height on both ends, so a small band is safe
+		if (!FMath::IsNearlyEqual(LFDiff.Z, nMove->LFDiff.Z, MoveComp->RoomscaleCombineHeightTolerance))
+			return false;
+
+		// Every point on a path of length L between two points D apart lies within sqrt(L^2 - D^2) / 2 of the straight line
+		// between them, so that bounds how far the combined move can stray from where the HMD actually went.
+		const float PathLength = GetRoomscalePathLength() + nMove->GetRoomscalePathLength();
+		const float CombinedDistance = FVector2D(LFDiff.X + nMove->LFDiff.X, LFDiff.Y + nMove->LFDiff.Y).Size();
+
+		if ((FMath::Square(PathLength) - FMath::Square(CombinedDistance)) > FMath::Square(MoveComp->RoomscaleCombineMaxError * 2.0f))
+			return false;
+	}
+	else
+	{
+		// Hate this but we really can't combine if I am sending a new capsule height
+		if (!FMath::IsNearlyEqual(LFDiff.Z, nMove->LFDiff.Z))
+			return false;
+
+		if (!FVector2D(LFDiff.X, LFDiff.Y).IsZero() && !FVector2D(nMove->LFDiff.X, nMove->LFDiff.Y).IsZero() && !FVector::Coincident(LFDiff.GetSafeNormal2D(), nMove->LFDiff.GetSafeNormal2D(), AccelDotThresholdCombine))
+			return false;
+	}
 
 	return FSavedMove_Character::CanCombineWith(NewMove, Character, MaxDelta);
 }
@@ -164,6 +184,7 @@ void FSavedMove_VRBaseCharacter::CombineWith(const FSavedMove_Character* OldMove
 
 	if (/*BaseSavedMove && */BaseSavedMovePending)
 	{
+		RoomscalePathLength = GetRoomscalePathLength() + BaseSavedMovePending->GetRoomscalePathLength();
 		LFDiff.X += BaseSavedMovePending->LFDiff.X;
 		LFDiff.Y += BaseSavedMovePending->LFDiff.Y;
 	}
@@ -219,6 +240,7 @@ void FSavedMove_VRBaseCharacter::Clear()
 	VRCapsuleLocation = FVector::ZeroVector;
 	VRCapsuleRotation = FRotator::ZeroRotator;
 	LFDiff = FVector::ZeroVector;
+	RoomscalePathLength = 0.0f;
 
 	ConditionalValues.CustomVRInputVector = FVector::ZeroVector;
 	ConditionalValues.RequestedVelocity = FVector::ZeroVector;
@@ -290,6 +312,7 @@ FVRCharacterNetworkMoveData::FVRCharacterNetworkMoveData() : FCharacterNetworkMo
 	LFDiff = FVector::ZeroVector;
 	VRCapsuleRotation = 0;
 	ReplicatedMovementMode = EVRConjoinedMovementModes::C_MOVE_MAX;
+	DeltaBaseMoveData = nullptr;
 }
 
 FVRCharacterNetworkMoveData::~FVRCharacterNetworkMoveData()
@@ -318,6 +341,12 @@ bool FVRCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& Charact
 {
 	NetworkMoveType = MoveType;
 
+	UVRBaseCharacterMovementComponent* BaseMovementComponent = Cast<UVRBaseCharacterMovementComponent>(&CharacterMovement);
+	if (BaseMovementComponent && BaseMovementComponent->bUseDeltaCompressedMoveData)
+	{
+		return SerializeDeltaCompressed(*BaseMovementComponent, Ar, PackageMap);
+	}
+
 	bool bLocalSuccess = true;
 	const bool bIsSaving = Ar.IsSaving();
 
@@ -447,6 +476,261 @@ bool FVRCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& Charact
 	return !Ar.IsError();
 }
 
+bool FVRCharacterNetworkMoveData::SerializeDeltaCompressed(UVRBaseCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap)
+{
+	enum EDeltaMoveFields : uint16
+	{
+		DeltaMove_Acceleration = 1 << 0,
+		DeltaMove_ControlRotation = 1 << 1,
+		DeltaMove_CompressedFlags = 1 << 2,
+		DeltaMove_MovementMode = 1 << 3,
+		DeltaMove_VRCapsuleLocation = 1 << 4,
+		DeltaMove_VRCapsuleRotation = 1 << 5,
+		DeltaMove_Location = 1 << 6,
+		DeltaMove_MovementBase = 1 << 7,
+		DeltaMove_ReplicatedMovementMode = 1 << 8,
+		DeltaMove_LFDiffXY = 1 << 9,
+		DeltaMove_LFDiffZ = 1 << 10,
+		DeltaMove_NumFields = 11
+	};
+
+	// The new move is written against the defaults
+	static const FVRCharacterNetworkMoveData DefaultMoveData;
+	const FVRCharacterNetworkMoveData& Base = DeltaBaseMoveData ? *DeltaBaseMoveData : DefaultMoveData;
+
+	bool bLocalSuccess = true;
+	const bool bIsSaving = Ar.IsSaving();
+
+	// Full timestamp, the server needs it exact to rebuild the move delta times
+	Ar << TimeStamp;
+
+	// Same gate as the regular serializer, roll and pitch are only sent when the character uses them
+	ACharacter* CharacterOwner = CharacterMovement.GetCharacterOwner();
+	const bool bCanRepRollAndPitch = (CharacterOwner && (CharacterOwner->bUseControllerRotationRoll || CharacterOwner->bUseControllerRotationPitch));
+
+	uint16 Yaw = FRotator::CompressAxisToShort(ControlRotation.Yaw);
+	uint16 Pitch = bCanRepRollAndPitch ? FRotator::CompressAxisToShort(ControlRotation.Pitch) : 0;
+	uint16 Roll = bCanRepRollAndPitch ? FRotator::CompressAxisToShort(ControlRotation.Roll) : 0;
+
+	uint16 ChangedFields = 0;
+
+	if (bIsSaving)
+	{
+		// Exact compares, these are already rounded on the client when they match
+		if (Acceleration != Base.Acceleration)
+			ChangedFields |= DeltaMove_Acceleration;
+
+		const uint16 BasePitch = bCanRepRollAndPitch ? FRotator::CompressAxisToShort(Base.ControlRotation.Pitch) : 0;
+		const uint16 BaseRoll = bCanRepRollAndPitch ? FRotator::CompressAxisToShort(Base.ControlRotation.Roll) : 0;
+
+		if (Yaw != FRotator::CompressAxisToShort(Base.ControlRotation.Yaw) || Pitch != BasePitch || Roll != BaseRoll)
+			ChangedFields |= DeltaMove_ControlRotation;
+
+		if (CompressedMoveFlags != Base.CompressedMoveFlags)
+			ChangedFields |= DeltaMove_CompressedFlags;
+
+		if (MovementMode != Base.MovementMode)
+			ChangedFields |= DeltaMove_MovementMode;
+
+		if (VRCapsuleLocation != Base.VRCapsuleLocation)
+			ChangedFields |= DeltaMove_VRCapsuleLocation;
+
+		if (VRCapsuleRotation != Base.VRCapsuleRotation)
+			ChangedFields |= DeltaMove_VRCapsuleRotation;
+
+		if (Location != Base.Location)
+			ChangedFields |= DeltaMove_Location;
+
+		if (MovementBase != Base.MovementBase || MovementBaseBoneName != Base.MovementBaseBoneName)
+			ChangedFields |= DeltaMove_MovementBase;
+
+		if (ReplicatedMovementMode != Base.ReplicatedMovementMode)
+			ChangedFields |= DeltaMove_ReplicatedMovementMode;
+
+		// The roomscale delta is per move, so it is sent as is instead of against the base
+		if (LFDiff.X != 0.0f || LFDiff.Y != 0.0f)
+			ChangedFields |= DeltaMove_LFDiffXY;
+
+		// Z is the capsule height, which rarely changes between moves
+		if (LFDiff.Z != Base.LFDiff.Z)
+			ChangedFields |= DeltaMove_LFDiffZ;
+	}
+
+	Ar.SerializeBits(&ChangedFields, DeltaMove_NumFields);
+
+	if (ChangedFields & DeltaMove_Acceleration)
+	{
+		Acceleration.NetSerialize(Ar, PackageMap, bLocalSuccess);
+	}
+	else if (!bIsSaving)
+	{
+		Acceleration = Base.Acceleration;
+	}
+
+	if (ChangedFields & DeltaMove_ControlRotation)
+	{
+		bool bRepRollAndPitch = bCanRepRollAndPitch && (Roll != 0 || Pitch != 0);
+		Ar.SerializeBits(&bRepRollAndPitch, 1);
+
+		uint32 Yaw32 = Yaw;
+		Ar.SerializeIntPacked(Yaw32);
+
+		uint32 Rotation32 = (((uint32)Roll) << 16) | ((uint32)Pitch);
+		if (bRepRollAndPitch)
+		{
+			Ar.SerializeIntPacked(Rotation32);
+		}
+
+		if (!bIsSaving)
+		{
+			ControlRotation.Yaw = FRotator::DecompressAxisFromShort((uint16)Yaw32);
+			ControlRotation.Pitch = bRepRollAndPitch ? FRotator::DecompressAxisFromShort((uint16)(Rotation32 & 65535)) : 0.0f;
+			ControlRotation.Roll = bRepRollAndPitch ? FRotator::DecompressAxisFromShort((uint16)(Rotation32 >> 16)) : 0.0f;
+		}
+	}
+	else if (!bIsSaving)
+	{
+		ControlRotation = Base.ControlRotation;
+	}
+
+	if (ChangedFields & DeltaMove_CompressedFlags)
+	{
+		Ar << CompressedMoveFlags;
+	}
+	else if (!bIsSaving)
+	{
+		CompressedMoveFlags = Base.CompressedMoveFlags;
+	}
+
+	if (ChangedFields & DeltaMove_MovementMode)
+	{
+		Ar << MovementMode;
+	}
+	else if (!bIsSaving)
+	{
+		MovementMode = Base.MovementMode;
+	}
+
+	// Locations are written relative to the base, packed vectors get smaller with the value
+	if (ChangedFields & DeltaMove_VRCapsuleLocation)
+	{
+		FVector Delta = bIsSaving ? (FVector)(VRCapsuleLocation - Base.VRCapsuleLocation) : FVector::ZeroVector;
+		bLocalSuccess &= SerializePackedVector<100, 30>(Delta, Ar);
+
+		if (!bIsSaving)
+		{
+			VRCapsuleLocation = Base.VRCapsuleLocation + Delta;
+		}
+	}
+	else if (!bIsSaving)
+	{
+		VRCapsuleLocation = Base.VRCapsuleLocation;
+	}
+
+	if (ChangedFields & DeltaMove_VRCapsuleRotation)
+	{
+		Ar << VRCapsuleRotation;
+	}
+	else if (!bIsSaving)
+	{
+		VRCapsuleRotation = Base.VRCapsuleRotation;
+	}
+
+	if (ChangedFields & DeltaMove_Location)
+	{
+		FVector Delta = bIsSaving ? (FVector)(Location - Base.Location) : FVector::ZeroVector;
+		bLocalSuccess &= SerializePackedVector<100, 30>(Delta, Ar);
+
+		if (!bIsSaving)
+		{
+			Location = Base.Location + Delta;
+		}
+	}
+	else if (!bIsSaving)
+	{
+		Location = Base.Location;
+	}
+
+	if (ChangedFields & DeltaMove_MovementBase)
+	{
+		SerializeOptionalValue<UPrimitiveComponent*>(bIsSaving, Ar, MovementBase, nullptr);
+		SerializeOptionalValue<FName>(bIsSaving, Ar, MovementBaseBoneName, NAME_None);
+	}
+	else if (!bIsSaving)
+	{
+		MovementBase = Base.MovementBase;
+		MovementBaseBoneName = Base.MovementBaseBoneName;
+	}
+
+	if (ChangedFields & DeltaMove_ReplicatedMovementMode)
+	{
+		Ar.SerializeBits(&ReplicatedMovementMode, 6);
+	}
+	else if (!bIsSaving)
+	{
+		ReplicatedMovementMode = Base.ReplicatedMovementMode;
+	}
+
+	// Rep out our custom move settings, these already skip what isn't set
+	ConditionalMoveReps.NetSerialize(Ar, PackageMap, bLocalSuccess);
+
+	if (ChangedFields & DeltaMove_LFDiffXY)
+	{
+		EVRMoveDataLFDiffQuantization Quantization = CharacterMovement.MoveDataLFDiffQuantization;
+		if (Quantization == EVRMoveDataLFDiffQuantization::MatchRoomscaleMode)
+		{
+			AVRBaseCharacter* VRChar = Cast<AVRBaseCharacter>(CharacterMovement.GetCharacterOwner());
+			Quantization = (VRChar && !VRChar->bRetainRoomscale) ? EVRMoveDataLFDiffQuantization::RoundFourDecimals : EVRMoveDataLFDiffQuantization::RoundTwoDecimals;
+		}
+
+		FVector DiffXY(LFDiff.X, LFDiff.Y, 0.0f);
+
+		switch (Quantization)
+		{
+		case EVRMoveDataLFDiffQuantization::RoundOneDecimal:
+		{
+			bLocalSuccess &= SerializePackedVector<10, 24>(DiffXY, Ar);
+		}break;
+		case EVRMoveDataLFDiffQuantization::RoundTwoDecimals:
+		{
+			bLocalSuccess &= SerializePackedVector<100, 30>(DiffXY, Ar);
+		}break;
+		case EVRMoveDataLFDiffQuantization::RoundFourDecimals:
+		default:
+		{
+			bLocalSuccess &= SerializePackedVector<10000, 32>(DiffXY, Ar);
+		}break;
+		}
+
+		LFDiff.X = DiffXY.X;
+		LFDiff.Y = DiffXY.Y;
+	}
+	else if (!bIsSaving)
+	{
+		LFDiff.X = 0.0f;
+		LFDiff.Y = 0.0f;
+	}
+
+	if (ChangedFields & DeltaMove_LFDiffZ)
+	{
+		// Same precision as the replicated capsule height
+		if (bIsSaving)
+		{
+			bLocalSuccess &= WriteFixedCompressedFloat<1024, 18>(LFDiff.Z, Ar);
+		}
+		else
+		{
+			bLocalSuccess &= ReadFixedCompressedFloat<1024, 18>(LFDiff.Z, Ar);
+		}
+	}
+	else if (!bIsSaving)
+	{
+		LFDiff.Z = Base.LFDiff.Z;
+	}
+
+	return !Ar.IsError();
+}
+
 
 void FVRCharacterMoveResponseDataContainer::ServerFillResponseData(const UCharacterMovementComponent& CharacterMovement, const FClientAdjustment& PendingAdjustment)
 {
@@ -7,6 +7,8 @@
 #include "IHeadMountedDisplay.h"
 #include "HeadMountedDisplayTypes.h"
 #include "Misc/ScopeLock.h"
+#include "Misc/ScopeTryLock.h"
+#include "Algo/BinarySearch.h"
 #include "Net/UnrealNetwork.h"
 #include "PrimitiveSceneInfo.h"
 #include "Engine/World.h"
@@ -24,6 +26,7 @@
 #include "VRCharacter.h"
 #include "VRRootComponent.h"
 #include "VRGlobalSettings.h"
+#include "Misc/GripTickSubsystem.h"
 #include "Math/DualQuat.h"
 #include "IIdentifiableXRDevice.h" // for FXRDeviceId
 #include "XRMotionControllerBase.h" // for GetHandEnumForSourceName()
@@ -66,60 +69,10 @@ const float ANGULAR_DAMPING_MULTIPLIER = 1.4f;
 // Multiplier for the Interactive Hybrid With Physics grip - When not colliding increases stiffness by this value
 const float HYBRID_PHYSICS_GRIP_MULTIPLIER = 10.0f;
 
-namespace {
-	/** This is to prevent destruction of motion controller components while they are
-	in the middle of being accessed by the render thread */
-	FCriticalSection CritSect;
-
-} // anonymous namespace
-
-namespace GripUEMotionController {
-	// A scoped lock that must be explicitly locked and will unlock upon destruction if locked.
-	// Convenient if you only sometimes want to lock and the scopes are complicated.
-	class FScopeLockOptional
-	{
-	public:
-		FScopeLockOptional()
-		{
-		}
-
-		void Lock(FCriticalSection* InSynchObject)
-		{
-			SynchObject = InSynchObject;
-			SynchObject->Lock();
-		}
-
-		/** Destructor that performs a release on the synchronization object. */
-		~FScopeLockOptional()
-		{
-			Unlock();
-		}
-
-		void Unlock()
-		{
-			if (SynchObject)
-			{
-				SynchObject->Unlock();
-				SynchObject = nullptr;
-			}
-		}
-
-	private:
-		/** Copy constructor( hidden on purpose). */
-		FScopeLockOptional(const FScopeLockOptional& InScopeLock);
-
-		/** Assignment operator (hidden on purpose). */
-		FScopeLockOptional& operator=(FScopeLockOptional& InScopeLock)
-		{
-			return *this;
-		}
-
-	private:
-
-		// Holds the synchronization object to aggregate and scope manage.
-		FCriticalSection* SynchObject = nullptr;
-	};
-}
+// Adaptive controller replication, how long to wait on an ack before sending another keyframe, and how old an acked keyframe
+// can get before we replace it. Keyframe IDs wrap every 16 keyframes so the max age needs to stay well under 16 * resend time.
+const float ADAPTIVE_KEYFRAME_RESEND_TIME = 0.25f;
+const float ADAPTIVE_KEYFRAME_MAX_AGE = 2.0f;
 
   // CVars
 namespace GripMotionControllerCvars
@@ -166,6 +119,19 @@ UGripMotionControllerComponent::UGripMotionControllerComponent(const FObjectInit
 	bLerpingPosition = false;
 	bSmoothReplicatedMotion = false;
 	bReppedOnce = false;
+	bCoalesceTransformSend = false;
+	bUseAdaptiveControllerReplication = false;
+	AdaptiveMinNetUpdateRate = 20.0f;
+	AdaptiveFullRateLinearSpeed = 100.0f;
+	AdaptiveFullRateAngularSpeed = 180.0f;
+	AdaptiveMaxDeltaDistance = 60.0f;
+	bExtrapolateReplicatedMotion = false;
+	MaxReplicatedExtrapolationTime = 0.1f;
+	ReplicatedLinearVelocity = FVector::ZeroVector;
+	ReplicatedAngularVelocity = FVector::ZeroVector;
+	LastReplicatedTransformTime = -1.0f;
+	LastReplicatedPosition = FVector::ZeroVector;
+	LastReplicatedRotation = FQuat::Identity;
 	bScaleTracking = false;
 	TrackingScaler = FVector(1.0f);
 	bLimitMinHeight = false;
@@ -176,6 +142,8 @@ UGripMotionControllerComponent::UGripMotionControllerComponent(const FObjectInit
 	bLeashToHMD = false;
 	LeashRange = 300.0f;
 	bConstrainToPivot = false;
+	PhysicsHandlePoolSize = 2;
+	bPrewarmPhysicsHandlePool = false;
 
 	bSmoothHandTracking = false;
 	bWasSmoothingHand = false;
@@ -207,6 +175,11 @@ UGripMotionControllerComponent::UGripMotionControllerComponent(const FObjectInit
 	VelocitySamples = 30.f;
 
 	bProjectNonSimulatingGrips = false;
+	bGripIndexDirty = true;
+	bPhysicsGripIndexDirty = true;
+	bPendingBatchedGripTick = false;
+	PendingBatchedGripDeltaTime = 0.0f;
+
 	EndPhysicsTickFunction.TickGroup = TG_EndPhysics;
 	EndPhysicsTickFunction.bCanEverTick = true;
 	EndPhysicsTickFunction.bStartWithTickEnabled = false;
@@ -242,6 +215,9 @@ void UGripMotionControllerComponent::EndPhysicsTickComponent(FGripComponentEndPh
 	if (!IsValid(this))
 		return;
 
+	// Resolve any grip sweeps that were queued up during the grip tick
+	ProcessGripSweepBatch();
+
 	// Now check if we should turn off any post physics ticking
 	FTransform baseTrans = this->GetAttachParent()->GetComponentTransform().Inverse();
 
@@ -332,6 +308,131 @@ void UGripMotionControllerComponent::EndPhysicsTickComponent(FGripComponentEndPh
 	}
 }
 
+void UGripMotionControllerComponent::QueueGripSweep(uint8 GripID, UPrimitiveComponent* Component, const FVector& Start, const FVector& End, const FQuat& Rotation, bool bIsHybridSweep, bool bCheckFallbackRotation, const FQuat& FallbackRotation)
+{
+	FGripSweepRequest& Request = PendingGripSweeps.AddDefaulted_GetRef();
+	Request.Component = Component;
+	Request.Start = Start;
+	Request.End = End;
+	Request.Rotation = Rotation;
+	Request.FallbackRotation = FallbackRotation;
+	Request.GripID = GripID;
+	Request.bIsHybridSweep = bIsHybridSweep;
+	Request.bCheckFallbackRotation = bCheckFallbackRotation;
+
+	// Only registers on the first queued sweep, it then stays registered until the last batched sweep grip is dropped
+	if (!EndPhysicsTickFunction.IsTickFunctionRegistered())
+	{
+		RegisterEndPhysicsTick(true);
+	}
+}
+
+void UGripMotionControllerComponent::ProcessGripSweepBatch()
+{
+	if (!PendingGripSweeps.Num())
+		return;
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		PendingGripSweeps.Reset();
+		return;
+	}
+
+	// Swap out the list so that hit events that drop or re-grip can't modify it while we are iterating
+	Swap(PendingGripSweeps, ProcessingGripSweeps);
+
+	for (const FGripSweepRequest& Request : ProcessingGripSweeps)
+	{
+		UPrimitiveComponent* SweepComp = Request.Component.Get();
+		if (!IsValid(SweepComp) || !SweepComp->IsQueryCollisionEnabled())
+			continue;
+
+		bool bHit = false;
+
+		if (Request.bIsHybridSweep)
+		{
+			FComponentQueryParams Params(NAME_None, this->GetOwner());
+			InitHybridSweepParams(Params, SweepComp->GetOwner(), SweepComp);
+
+			bHit = World->ComponentSweepMulti(GripSweepHits, SweepComp, Request.Start, Request.End, Request.Rotation, Params) && HasUnignoredBlockingHit(SweepComp, GripSweepHits);
+
+			// Check the other rotation
+			if (!bHit && Request.bCheckFallbackRotation)
+			{
+				bHit = World->ComponentSweepMulti(GripSweepHits, SweepComp, Request.Start, Request.End, Request.FallbackRotation, Params) && HasUnignoredBlockingHit(SweepComp, GripSweepHits);
+			}
+		}
+		else
+		{
+			bHit = CheckComponentWithSweepFrom(SweepComp, Request.Start, Request.End - Request.Start, Request.Rotation.Rotator(), false);
+		}
+
+		// Child component sweeps are only for their hit events
+		if (Request.GripID != INVALID_VRGRIP_ID)
+		{
+			if (FBPActorGripInformation* Grip = FindGripByID(Request.GripID))
+			{
+				Grip->ValueCache.bHasBatchedSweepResult = true;
+				Grip->ValueCache.bBatchedSweepHit = bHit;
+			}
+		}
+	}
+
+	ProcessingGripSweeps.Reset();
+}
+
+bool UGripMotionControllerComponent::HasBatchedSweepGrips() const
+{
+	const UVRGlobalSettings* VRSettings = GetDefault<UVRGlobalSettings>();
+	if (!VRSettings || !VRSettings->bBatchGripSweepsInEndPhysics)
+		return false;
+
+	auto UsesBatchedSweep = [](const FBPActorGripInformation& Grip)
+	{
+		return !Grip.bIsPendingKill &&
+			(Grip.GripCollisionType == EGripCollisionType::SweepWithPhysics || Grip.GripCollisionType == EGripCollisionType::InteractiveHybridCollisionWithSweep);
+	};
+
+	return LocallyGrippedObjects.ContainsByPredicate(UsesBatchedSweep) || GrippedObjects.ContainsByPredicate(UsesBatchedSweep);
+}
+
+void UGripMotionControllerComponent::InitHybridSweepParams(FComponentQueryParams& Params, AActor* actor, UPrimitiveComponent* root)
+{
+	//Params.bTraceAsyncScene = root->bCheckAsyncSceneOnMove;
+	Params.AddIgnoredActor(actor);
+	Params.AddIgnoredActors(root->MoveIgnoreActors);
+
+	if (actor)
+	{
+		actor->ForEachAttachedActors([&Params](AActor* Actor)
+		{
+			Params.AddIgnoredActor(Actor);
+			return true;
+		});
+	}
+}
+
+bool UGripMotionControllerComponent::HasUnignoredBlockingHit(UPrimitiveComponent* root, const TArray<FHitResult>& Hits)
+{
+	UCollisionIgnoreSubsystem* CollisionIgnoreSubsystem = GetWorld()->GetSubsystem<UCollisionIgnoreSubsystem>();
+
+	if (!CollisionIgnoreSubsystem || !CollisionIgnoreSubsystem->HasCollisionIgnorePairs())
+	{
+		return FHitResult::GetFirstBlockingHit(Hits) != nullptr;
+	}
+
+	for (const FHitResult& Hit : Hits)
+	{
+		if (Hit.bBlockingHit && !CollisionIgnoreSubsystem->AreComponentsIgnoringCollisions(root, Hit.Component.Get()))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void FGripComponentEndPhysicsTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
 {
 	QUICK_SCOPE_CYCLE_COUNTER(FGripComponentEndPhysicsTickFunction_ExecuteTick);
@@ -430,6 +531,12 @@ void UGripMotionControllerComponent::EndPlay(const EEndPlayReason::Type EndPlayR
 	// Cancel end physics tick
 	RegisterEndPhysicsTick(false);
 
+	if (UGripTickSubsystem* GripTickSubsystem = BatchedGripTickSubsystem.Get())
+	{
+		GripTickSubsystem->UnregisterController(this);
+	}
+	BatchedGripTickSubsystem.Reset();
+
 	if (NewControllerProfileEvent_Handle.IsValid())
 	{
 		UVRGlobalSettings* VRSettings = GetMutableDefault<UVRGlobalSettings>();
@@ -463,6 +570,7 @@ void UGripMotionControllerComponent::EndPlay(const EEndPlayReason::Type EndPlayR
 		}
 	}
 	GrippedObjects.Empty();
+	MarkGripIndexDirty();
 
 	for (int i = 0; i < LocallyGrippedObjects.Num(); i++)
 	{
@@ -487,12 +595,16 @@ void UGripMotionControllerComponent::EndPlay(const EEndPlayReason::Type EndPlayR
 		}
 	}
 	LocallyGrippedObjects.Empty();
+	MarkGripIndexDirty();
 
 	for (int i = 0; i < PhysicsGrips.Num(); i++)
 	{
 		DestroyPhysicsHandle(&PhysicsGrips[i]);
 	}
 	PhysicsGrips.Empty();
+	MarkPhysicsGripIndexDirty();
+
+	EmptyPhysicsHandlePool();
 
 	// Clear any timers that we are managing
 	if (UWorld * myWorld = GetWorld())
@@ -517,7 +629,7 @@ void UGripMotionControllerComponent::BeginDestroy()
 		{
 			// This component could be getting accessed from the render thread so it needs to wait
 			// before clearing MotionControllerComponent and allowing the destructor to continue
-			FScopeLock ScopeLock(&CritSect);
+			FScopeLock ScopeLock(&GripViewExtension->CritSect);
 			GripViewExtension->MotionControllerComponent = NULL;
 		}
 
@@ -528,6 +640,24 @@ void UGripMotionControllerComponent::BeginDestroy()
 void UGripMotionControllerComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	const UVRGlobalSettings* VRSettings = GetDefault<UVRGlobalSettings>();
+	if (VRSettings->bUseBatchedGripTick)
+	{
+		if (UWorld* World = GetWorld())
+		{
+			UGripTickSubsystem* GripTickSubsystem = World->GetSubsystem<UGripTickSubsystem>();
+			if (GripTickSubsystem && GripTickSubsystem->RegisterController(this))
+			{
+				BatchedGripTickSubsystem = GripTickSubsystem;
+			}
+		}
+	}
+
+	if (bPrewarmPhysicsHandlePool)
+	{
+		PrewarmPhysicsHandlePool();
+	}
 }
 
 void UGripMotionControllerComponent::CreateRenderState_Concurrent(FRegisterComponentContext* Context)
@@ -616,23 +746,146 @@ void UGripMotionControllerComponent::SendRenderTransform_Concurrent()
 
 FBPActorPhysicsHandleInformation * UGripMotionControllerComponent::GetPhysicsGrip(const FBPActorGripInformation & GripInfo)
 {
-	return PhysicsGrips.FindByKey(GripInfo);
+	return GetPhysicsGrip(GripInfo.GripID);
 }
 
 FBPActorPhysicsHandleInformation* UGripMotionControllerComponent::GetPhysicsGrip(const uint8 GripID)
 {
-	return PhysicsGrips.FindByKey(GripID);
+	int32 index = FindPhysicsGripIndex(GripID);
+	return index != INDEX_NONE ? &PhysicsGrips[index] : nullptr;
 }
 
 bool UGripMotionControllerComponent::GetPhysicsGripIndex(const FBPActorGripInformation & GripInfo, int & index)
 {
-	index = PhysicsGrips.IndexOfByKey(GripInfo);
+	index = FindPhysicsGripIndex(GripInfo.GripID);
 	return index != INDEX_NONE;
 }
 
+int32 UGripMotionControllerComponent::FindPhysicsGripIndex(uint8 GripID)
+{
+	if (GripID == INVALID_VRGRIP_ID)
+		return INDEX_NONE;
+
+	if (bPhysicsGripIndexDirty)
+		RebuildPhysicsGripIndex();
+
+	const int32* Slot = PhysicsGripIndex.Find(GripID);
+	if (!Slot)
+		return INDEX_NONE;
+
+	if (!PhysicsGrips.IsValidIndex(*Slot) || PhysicsGrips[*Slot].GripID != GripID)
+	{
+		// Array changed without being flagged, rebuild and try again
+		RebuildPhysicsGripIndex();
+		Slot = PhysicsGripIndex.Find(GripID);
+	}
+
+	return Slot ? *Slot : INDEX_NONE;
+}
+
+void UGripMotionControllerComponent::RebuildPhysicsGripIndex()
+{
+	PhysicsGripIndex.Reset();
+
+	for (int32 i = 0; i < PhysicsGrips.Num(); ++i)
+	{
+		if (PhysicsGrips[i].GripID != INVALID_VRGRIP_ID && !PhysicsGripIndex.Contains(PhysicsGrips[i].GripID))
+		{
+			PhysicsGripIndex.Add(PhysicsGrips[i].GripID, i);
+		}
+	}
+
+	bPhysicsGripIndexDirty = false;
+}
+
+void UGripMotionControllerComponent::RebuildGripIndex()
+{
+	GripIDIndex.Reset();
+	GripObjectIndex.Reset();
+
+	// First entry wins so that we match the GrippedObjects then LocallyGrippedObjects search order
+	auto IndexGripArray = [this](const TArray<FBPActorGripInformation>& GripArray, bool bIsLocalGrip)
+	{
+		for (int32 i = 0; i < GripArray.Num(); ++i)
+		{
+			const FBPActorGripInformation& Grip = GripArray[i];
+			FGripIndexEntry Entry{ bIsLocalGrip, i };
+
+			if (Grip.GripID != INVALID_VRGRIP_ID && !GripIDIndex.Contains(Grip.GripID))
+			{
+				GripIDIndex.Add(Grip.GripID, Entry);
+			}
+
+			if (Grip.GrippedObject && !GripObjectIndex.Contains(Grip.GrippedObject))
+			{
+				GripObjectIndex.Add(Grip.GrippedObject, Entry);
+			}
+		}
+	};
+
+	IndexGripArray(GrippedObjects, false);
+	IndexGripArray(LocallyGrippedObjects, true);
+
+	bGripIndexDirty = false;
+}
+
+FBPActorGripInformation* UGripMotionControllerComponent::ResolveGripIndexEntry(const FGripIndexEntry& Entry)
+{
+	TArray<FBPActorGripInformation>& GripArray = Entry.bIsLocalGrip ? LocallyGrippedObjects : GrippedObjects;
+	return GripArray.IsValidIndex(Entry.Slot) ? &GripArray[Entry.Slot] : nullptr;
+}
+
+FBPActorGripInformation* UGripMotionControllerComponent::FindGripByID(uint8 GripID)
+{
+	if (GripID == INVALID_VRGRIP_ID)
+		return nullptr;
+
+	if (bGripIndexDirty)
+		RebuildGripIndex();
+
+	const FGripIndexEntry* Entry = GripIDIndex.Find(GripID);
+	if (!Entry)
+		return nullptr;
+
+	FBPActorGripInformation* Grip = ResolveGripIndexEntry(*Entry);
+	if (!Grip || Grip->GripID != GripID)
+	{
+		// Array changed without being flagged, rebuild and try again
+		RebuildGripIndex();
+		Entry = GripIDIndex.Find(GripID);
+		Grip = Entry ? ResolveGripIndexEntry(*Entry) : nullptr;
+	}
+
+	return Grip;
+}
+
+FBPActorGripInformation* UGripMotionControllerComponent::FindGripByObject(const UObject* Object)
+{
+	if (!Object)
+		return nullptr;
+
+	if (bGripIndexDirty)
+		RebuildGripIndex();
+
+	const FGripIndexEntry* Entry = GripObjectIndex.Find(Object);
+	if (!Entry)
+		return nullptr;
+
+	FBPActorGripInformation* Grip = ResolveGripIndexEntry(*Entry);
+	if (!Grip || Grip->GrippedObject != Object)
+	{
+		// Array changed without being flagged, rebuild and try again
+		RebuildGripIndex();
+		Entry = GripObjectIndex.Find(Object);
+		Grip = Entry ? ResolveGripIndexEntry(*Entry) : nullptr;
+	}
+
+	return Grip;
+}
+
 FBPActorPhysicsHandleInformation * UGripMotionControllerComponent::CreatePhysicsGrip(const FBPActorGripInformation & GripInfo)
 {
-	FBPActorPhysicsHandleInformation * HandleInfo = PhysicsGrips.FindByKey(GripInfo);
+	FBPActorPhysicsHandleInformation * HandleInfo = GetPhysicsGrip(GripInfo);
 
 	if (HandleInfo)
 	{
@@ -645,6 +898,7 @@ FBPActorPhysicsHandleInformation * UGripMotionControllerComponent::CreatePhysics
 	NewInfo.GripID = GripInfo.GripID;
 
 	int index = PhysicsGrips.Add(NewInfo);
+	MarkPhysicsGripIndexDirty();
 
 	return &PhysicsGrips[index];
 }
@@ -686,6 +940,10 @@ void UGripMotionControllerComponent::GetLifetimeReplicatedProps(TArray< class FL
 
 void UGripMotionControllerComponent::Server_SendControllerTransform_Implementation(FBPVRComponentPosRep NewTransform)
 {
+	// Adaptive transforms can be relative to a keyframe, they need to be absolute before storing them for replication
+	if (!ResolveAdaptiveControllerTransform(NewTransform))
+		return;
+
 	// Store new transform and trigger OnRep_Function
 	ReplicatedControllerTransform = NewTransform;
 
@@ -700,6 +958,130 @@ bool UGripMotionControllerComponent::Server_SendControllerTransform_Validate(FBP
 	// Optionally check to make sure that player is inside of their bounds and deny it if they aren't?
 }
 
+float UGripMotionControllerComponent::GetAdaptiveControllerNetUpdateRate(const FVector& RelLoc, const FRotator& RelRot, float DeltaTime)
+{
+	FAdaptiveControllerRepState& State = AdaptiveRepState;
+
+	// Full rate until we have something to compare against
+	float SpeedAlpha = 1.0f;
+
+	if (State.bHasSample && DeltaTime > KINDA_SMALL_NUMBER)
+	{
+		const float LinearSpeed = FVector::Dist(RelLoc, State.LastSampleLocation) / DeltaTime;
+		const float AngularSpeed = FMath::RadiansToDegrees(RelRot.Quaternion().AngularDistance(State.LastSampleRotation.Quaternion())) / DeltaTime;
+
+		SpeedAlpha = FMath::Clamp(FMath::Max(LinearSpeed / FMath::Max(AdaptiveFullRateLinearSpeed, 0.01f), AngularSpeed / FMath::Max(AdaptiveFullRateAngularSpeed, 0.01f)), 0.0f, 1.0f);
+	}
+
+	State.LastSampleLocation = RelLoc;
+	State.LastSampleRotation = RelRot;
+	State.bHasSample = true;
+
+	return FMath::Lerp(FMath::Min(AdaptiveMinNetUpdateRate, ControllerNetUpdateRate), ControllerNetUpdateRate, SpeedAlpha);
+}
+
+void UGripMotionControllerComponent::BuildAdaptiveControllerTransform(FBPVRComponentPosRep& OutTransform)
+{
+	typedef FBPVRComponentPosRep::EPositionEncoding EPositionEncoding;
+	FAdaptiveControllerRepState& State = AdaptiveRepState;
+
+	OutTransform = ReplicatedControllerTransform;
+	OutTransform.RotationQuantizationLevel = EVRRotationQuantization::RoundToSmallestThree;
+	OutTransform.PositionEncoding = EPositionEncoding::Absolute;
+
+	const float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+
+	if (State.bHasAckedKeyframe && (CurrentTime - State.SentKeyframeTimes[State.AckedKeyframeID]) <= ADAPTIVE_KEYFRAME_MAX_AGE)
+	{
+		const FVector Delta = OutTransform.Position - State.SentKeyframes[State.AckedKeyframeID];
+
+		if (Delta.SizeSquared() <= FMath::Square(AdaptiveMaxDeltaDistance))
+		{
+			OutTransform.PositionEncoding = EPositionEncoding::Delta;
+			OutTransform.KeyframeID = State.AckedKeyframeID;
+			OutTransform.Position = Delta;
+			return;
+		}
+	}
+
+	// No usable keyframe, send a new one unless the last one could still be getting acked
+	if (State.LastKeyframeSendTime < 0.0f || (CurrentTime - State.LastKeyframeSendTime) >= ADAPTIVE_KEYFRAME_RESEND_TIME)
+	{
+		const uint8 NewKeyframeID = State.NextKeyframeID;
+		State.NextKeyframeID = (NewKeyframeID + 1) % FAdaptiveControllerRepState::NumKeyframes;
+
+		// Store it how the server will see it so that the deltas line up
+		State.SentKeyframes[NewKeyframeID] = FBPVRComponentPosRep::QuantizePosition(OutTransform.Position, OutTransform.QuantizationLevel);
+		State.SentKeyframeTimes[NewKeyframeID] = CurrentTime;
+		State.LastKeyframeSendTime = CurrentTime;
+
+		OutTransform.PositionEncoding = EPositionEncoding::Keyframe;
+		OutTransform.KeyframeID = NewKeyframeID;
+	}
+}
+
+bool UGripMotionControllerComponent::ResolveAdaptiveControllerTransform(FBPVRComponentPosRep& InOutTransform)
+{
+	typedef FBPVRComponentPosRep::EPositionEncoding EPositionEncoding;
+	FAdaptiveControllerRepState& State = AdaptiveRepState;
+
+	if (InOutTransform.RotationQuantizationLevel != EVRRotationQuantization::RoundToSmallestThree || InOutTransform.KeyframeID >= FAdaptiveControllerRepState::NumKeyframes)
+		return true;
+
+	switch (InOutTransform.PositionEncoding)
+	{
+	case EPositionEncoding::Keyframe:
+	{
+		State.ReceivedKeyframes[InOutTransform.KeyframeID] = InOutTransform.Position;
+		State.ReceivedKeyframeMask |= (1 << InOutTransform.KeyframeID);
+
+		// Only ack new keyframes, the client sends a new one if the ack gets lost
+		if (InOutTransform.KeyframeID != State.LastReceivedKeyframeID)
+		{
+			State.LastReceivedKeyframeID = InOutTransform.KeyframeID;
+			Client_AckControllerKeyframe(InOutTransform.KeyframeID);
+		}
+	}break;
+
+	case EPositionEncoding::Delta:
+	{
+		// Out of order against a keyframe we never got, skip it
+		if (!(State.ReceivedKeyframeMask & (1 << InOutTransform.KeyframeID)))
+			return false;
+
+		InOutTransform.Position = State.ReceivedKeyframes[InOutTransform.KeyframeID] + InOutTransform.Position;
+	}break;
+
+	default:break;
+	}
+
+	// Stored as absolute for the property replication
+	InOutTransform.PositionEncoding = EPositionEncoding::Absolute;
+	return true;
+}
+
+void UGripMotionControllerComponent::Client_AckControllerKeyframe_Implementation(uint8 KeyframeID)
+{
+	FAdaptiveControllerRepState& State = AdaptiveRepState;
+
+	if (KeyframeID >= FAdaptiveControllerRepState::NumKeyframes)
+		return;
+
+	const float SentTime = State.SentKeyframeTimes[KeyframeID];
+	const float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+
+	// Never sent or old enough that the ID may have wrapped
+	if (SentTime < 0.0f || (CurrentTime - SentTime) > ADAPTIVE_KEYFRAME_MAX_AGE)
+		return;
+
+	// Don't go back to an older keyframe if the acks come in out of order
+	if (State.bHasAckedKeyframe && State.SentKeyframeTimes[State.AckedKeyframeID] > SentTime)
+		return;
+
+	State.bHasAckedKeyframe = true;
+	State.AckedKeyframeID = KeyframeID;
+}
+
 void UGripMotionControllerComponent::FGripViewExtension::BeginRenderViewFamily(FSceneViewFamily& InViewFamily)
 {
 	if (!MotionControllerComponent)
@@ -796,9 +1178,7 @@ void UGripMotionControllerComponent::GetGripByActor(FBPActorGripInformation &Gri
 		return;
 	}
 
-	FBPActorGripInformation * GripInfo = GrippedObjects.FindByKey(ActorToLookForGrip);
-	if(!GripInfo)
-		GripInfo = LocallyGrippedObjects.FindByKey(ActorToLookForGrip);
+	FBPActorGripInformation * GripInfo = FindGripByObject(ActorToLookForGrip);
 	
 	if (GripInfo)
 	{
@@ -818,9 +1198,7 @@ void UGripMotionControllerComponent::GetGripByComponent(FBPActorGripInformation
 		return;
 	}
 
-	FBPActorGripInformation * GripInfo = GrippedObjects.FindByKey(ComponentToLookForGrip);
-	if(!GripInfo)
-		GripInfo = LocallyGrippedObjects.FindByKey(ComponentToLookForGrip);
+	FBPActorGripInformation * GripInfo = FindGripByObject(ComponentToLookForGrip);
 
 	if (GripInfo)
 	{
@@ -840,9 +1218,7 @@ void UGripMotionControllerComponent::GetGripByObject(FBPActorGripInformation &Gr
 		return;
 	}
 
-	FBPActorGripInformation * GripInfo = GrippedObjects.FindByKey(ObjectToLookForGrip);
-	if(!GripInfo)
-		GripInfo = LocallyGrippedObjects.FindByKey(ObjectToLookForGrip);
+	FBPActorGripInformation * GripInfo = FindGripByObject(ObjectToLookForGrip);
 
 	if (GripInfo)
 	{
@@ -861,11 +1237,7 @@ FBPActorGripInformation * UGripMotionControllerComponent::GetGripPtrByID(uint8 I
 		return nullptr;
 	}
 
-	FBPActorGripInformation* GripInfo = GrippedObjects.FindByKey(IDToLookForGrip);
-	if (!GripInfo)
-		GripInfo = LocallyGrippedObjects.FindByKey(IDToLookForGrip);
-
-	return GripInfo;
+	return FindGripByID(IDToLookForGrip);
 }
 
 void UGripMotionControllerComponent::GetGripByID(FBPActorGripInformation &Grip, uint8 IDToLookForGrip, EBPVRResultSwitch &Result)
@@ -876,9 +1248,7 @@ void UGripMotionControllerComponent::GetGripByID(FBPActorGripInformation &Grip,
 		return;
 	}
 
-	FBPActorGripInformation * GripInfo = GrippedObjects.FindByKey(IDToLookForGrip);
-	if (!GripInfo)
-		GripInfo = LocallyGrippedObjects.FindByKey(IDToLookForGrip);
+	FBPActorGripInformation * GripInfo = FindGripByID(IDToLookForGrip);
 
 	if (GripInfo)
 	{
@@ -1601,6 +1971,7 @@ bool UGripMotionControllerComponent::GripActor(
 
 	// So that events caused by sweep and the like will trigger correctly
 	ActorToGrip->AddTickPrerequisiteComponent(this);
+	SetBatchedGripTickPrerequisite(ActorToGrip->PrimaryActorTick, true);
 
 	FBPActorGripInformation newActorGrip;
 	newActorGrip.GripID = GetNextGripID(bIsLocalGrip);
@@ -1686,6 +2057,7 @@ bool UGripMotionControllerComponent::GripActor(
 	if (!bIsLocalGrip)
 	{
 		int32 Index = GrippedObjects.Add(newActorGrip);
+		MarkGripIndexDirty();
 		if (Index != INDEX_NONE)
 			NotifyGrip(GrippedObjects[Index]);
 		//NotifyGrip(newActorGrip);
@@ -1698,6 +2070,7 @@ bool UGripMotionControllerComponent::GripActor(
 		}
 
 		int32 Index = LocallyGrippedObjects.Add(newActorGrip);
+		MarkGripIndexDirty();
 
 		if (Index != INDEX_NONE)
 		{
@@ -1848,6 +2221,7 @@ bool UGripMotionControllerComponent::GripComponent(
 	// So that events caused by sweep and the like will trigger correctly
 
 	ComponentToGrip->AddTickPrerequisiteComponent(this);
+	SetBatchedGripTickPrerequisite(ComponentToGrip->PrimaryComponentTick, true);
 
 	FBPActorGripInformation newComponentGrip;
 	newComponentGrip.GripID = GetNextGripID(bIsLocalGrip);
@@ -1939,6 +2313,7 @@ bool UGripMotionControllerComponent::GripComponent(
 	if (!bIsLocalGrip)
 	{
 		int32 Index = GrippedObjects.Add(newComponentGrip);
+		MarkGripIndexDirty();
 		if (Index != INDEX_NONE)
 			NotifyGrip(GrippedObjects[Index]);
 
@@ -1952,6 +2327,7 @@ bool UGripMotionControllerComponent::GripComponent(
 		}
 
 		int32 Index = LocallyGrippedObjects.Add(newComponentGrip);
+		MarkGripIndexDirty();
 
 		if (Index != INDEX_NONE)
 		{
@@ -2510,6 +2886,7 @@ void UGripMotionControllerComponent::DropAndSocket_Implementation(const FBPActor
 			root = Cast<UPrimitiveComponent>(pActor->GetRootComponent());
 
 			pActor->RemoveTickPrerequisiteComponent(this);
+			SetBatchedGripTickPrerequisite(pActor->PrimaryActorTick, false);
 			//this->IgnoreActorWhenMoving(pActor, false);
 
 			if (APawn* OwningPawn = Cast<APawn>(GetOwner()))
@@ -2591,6 +2968,7 @@ void UGripMotionControllerComponent::DropAndSocket_Implementation(const FBPActor
 			pActor = root->GetOwner();
 
 			root->RemoveTickPrerequisiteComponent(this);
+			SetBatchedGripTickPrerequisite(root->PrimaryComponentTick, false);
 			//root->IgnoreActorWhenMoving(this->GetOwner(), false);
 
 			// Attachment already handles both of these
@@ -2669,6 +3047,7 @@ void UGripMotionControllerComponent::DropAndSocket_Implementation(const FBPActor
 		if (HasGripAuthority(NewDrop) || IsServer())
 		{
 			LocallyGrippedObjects.RemoveAt(fIndex);
+			MarkGripIndexDirty();
 		}
 		else
 		{
@@ -2684,6 +3063,7 @@ void UGripMotionControllerComponent::DropAndSocket_Implementation(const FBPActor
 			if (HasGripAuthority(NewDrop) || IsServer())
 			{
 				GrippedObjects.RemoveAt(fIndex);
+				MarkGripIndexDirty();
 			}
 			else
 			{
@@ -3000,6 +3380,10 @@ bool UGripMotionControllerComponent::NotifyGrip(FBPActorGripInformation &NewGrip
 	{}break;
 	}
 
+	// Resolve the interface values up front, with bCacheGripInterfaceValues the grip tick uses these instead of querying every frame
+	// The grip tick subsystem also checks them for which grips it can batch, the grip tick re-checks the live scripts when caching is off
+	CacheGripInterfaceValues(NewGrip, root, pActor);
+
 	bool bHasMovementAuthority = HasGripMovementAuthority(NewGrip);
 
 	switch (NewGrip.GripCollisionType)
@@ -3407,6 +3791,7 @@ void UGripMotionControllerComponent::Drop_Implementation(const FBPActorGripInfor
 			{
 
 				pActor->RemoveTickPrerequisiteComponent(this);
+				SetBatchedGripTickPrerequisite(pActor->PrimaryActorTick, false);
 				//this->IgnoreActorWhenMoving(pActor, false);
 
 				if (NewDrop.GripCollisionType != EGripCollisionType::EventsOnly)
@@ -3537,6 +3922,7 @@ void UGripMotionControllerComponent::Drop_Implementation(const FBPActorGripInfor
 			if (!bSkipFullDrop)
 			{
 				root->RemoveTickPrerequisiteComponent(this);
+				SetBatchedGripTickPrerequisite(root->PrimaryComponentTick, false);
 
 				/*if (APawn* OwningPawn = Cast<APawn>(GetOwner()))
 				{
@@ -3704,6 +4090,7 @@ void UGripMotionControllerComponent::Drop_Implementation(const FBPActorGripInfor
 		if (HasGripAuthority(NewDrop) || IsServer())
 		{
 			LocallyGrippedObjects.RemoveAt(fIndex);
+			MarkGripIndexDirty();
 		}
 		else
 		{
@@ -3719,6 +4106,7 @@ void UGripMotionControllerComponent::Drop_Implementation(const FBPActorGripInfor
 			if (HasGripAuthority(NewDrop) || IsServer())
 			{
 				GrippedObjects.RemoveAt(fIndex);
+				MarkGripIndexDirty();
 			}
 			else
 			{
@@ -3781,10 +4169,17 @@ void UGripMotionControllerComponent::Drop_Implementation(const FBPActorGripInfor
 					}
 				}
 			}
+
+			// Keep it around while batched sweep grips are still held instead of re-registering it every frame
+			if (!bNeedsPhysicsTick)
+			{
+				bNeedsPhysicsTick = HasBatchedSweepGrips();
+			}
 		}
 
 		if (!bNeedsPhysicsTick)
 		{
+			PendingGripSweeps.Reset();
 			RegisterEndPhysicsTick(false);
 		}
 	}
@@ -4521,7 +4916,7 @@ void UGripMotionControllerComponent::Deactivate()
 		{
 			// This component could be getting accessed from the render thread so it needs to wait
 			// before clearing MotionControllerComponent 
-			FScopeLock ScopeLock(&CritSect);
+			FScopeLock ScopeLock(&GripViewExtension->CritSect);
 			GripViewExtension->MotionControllerComponent = NULL;
 		}
 
@@ -4553,7 +4948,52 @@ void UGripMotionControllerComponent::OnRep_ReplicatedControllerTransform()
 		ApplyTrackingParameters(ReplicatedControllerTransform.Position, true, false);
 	}
 
-	if (bSmoothReplicatedMotion)
+	// Track the velocity between updates for extrapolation
+	if (bExtrapolateReplicatedMotion)
+	{
+		const float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+		const FQuat NewRotation = ReplicatedControllerTransform.Rotation.Quaternion();
+
+		if (LastReplicatedTransformTime >= 0.0f)
+		{
+			const float ElapsedTime = CurrentTime - LastReplicatedTransformTime;
+
+			// Multiple updates in one frame keep the last velocity
+			if (ElapsedTime > KINDA_SMALL_NUMBER)
+			{
+				ReplicatedLinearVelocity = (ReplicatedControllerTransform.Position - LastReplicatedPosition) / ElapsedTime;
+
+				FQuat DeltaRotation = NewRotation * LastReplicatedRotation.Inverse();
+				DeltaRotation.EnforceShortestArcWith(FQuat::Identity);
+
+				FVector Axis;
+				float Angle;
+				DeltaRotation.ToAxisAndAngle(Axis, Angle);
+				ReplicatedAngularVelocity = Axis * (Angle / ElapsedTime);
+			}
+		}
+
+		LastReplicatedTransformTime = CurrentTime;
+		LastReplicatedPosition = ReplicatedControllerTransform.Position;
+		LastReplicatedRotation = NewRotation;
+	}
+
+	if (bSmoothReplicatedMotion && bUseSnapshotInterpolation)
+	{
+		// Played back on the senders timeline when it was stamped, otherwise on when it arrived
+		const double ReceiveTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+		const double SendTime = ReplicatedControllerTransform.Timestamp > 0.0f ? (double)ReplicatedControllerTransform.Timestamp : ReceiveTime;
+		SnapshotBuffer.AddSnapshot(SendTime, ReceiveTime, ReplicatedControllerTransform.Position, ReplicatedControllerTransform.Rotation.Quaternion());
+
+		if (!bReppedOnce)
+		{
+			SetRelativeLocationAndRotation(ReplicatedControllerTransform.Position, ReplicatedControllerTransform.Rotation);
+			bReppedOnce = true;
+		}
+
+		bLerpingPosition = true;
+	}
+	else if (bSmoothReplicatedMotion)
 	{
 		if (bReppedOnce)
 		{
@@ -4707,11 +5147,20 @@ void UGripMotionControllerComponent::UpdateTracking(float DeltaTime)
 			FVector RelLoc = GetRelativeLocation();
 			FRotator RelRot = GetRelativeRotation();
 
-			// Don't rep if no changes
-			if (!RelLoc.Equals(ReplicatedControllerTransform.Position) || !RelRot.Equals(ReplicatedControllerTransform.Rotation))
+			// Adaptive replication backs the rate off when the hand is still
+			const float CurrentNetUpdateRate = (bUseAdaptiveControllerReplication && !bCoalesceTransformSend) ? GetAdaptiveControllerNetUpdateRate(RelLoc, RelRot, DeltaTime) : ControllerNetUpdateRate;
+
+			if (bCoalesceTransformSend)
+			{
+				// The owning character sends it on its own timer
+				ReplicatedControllerTransform.Position = RelLoc;
+				ReplicatedControllerTransform.Rotation = RelRot;
+			}
+			// Don't rep if no changes
+			else if (!RelLoc.Equals(ReplicatedControllerTransform.Position) || !RelRot.Equals(ReplicatedControllerTransform.Rotation))
 			{
 				ControllerNetUpdateCount += DeltaTime;
-				if (ControllerNetUpdateCount >= (1.0f / ControllerNetUpdateRate))
+				if (ControllerNetUpdateCount >= (1.0f / CurrentNetUpdateRate))
 				{
 					ControllerNetUpdateCount = 0.0f;
 
@@ -4719,18 +5168,31 @@ void UGripMotionControllerComponent::UpdateTracking(float DeltaTime)
 					ReplicatedControllerTransform.Position = RelLoc;
 					ReplicatedControllerTransform.Rotation = RelRot;
 
+					// Lets snapshot interpolation play it back on our timeline instead of when it arrived
+					ReplicatedControllerTransform.Timestamp = (bUseSnapshotInterpolation && GetWorld()) ? GetWorld()->GetTimeSeconds() : 0.0f;
+
 					// I would keep the torn off check here, except this can be checked on tick if they
 					// Set 100 htz updates, and in the TornOff case, it actually can't hurt any besides some small
 					// Perf difference.
 					if (!IsServer()/* && !IsTornOff()*/)
 					{
+						// ReplicatedControllerTransform stays absolute, it is what we compare against for changes
+						FBPVRComponentPosRep AdaptiveTransform;
+						const FBPVRComponentPosRep* TransformToSend = &ReplicatedControllerTransform;
+
+						if (bUseAdaptiveControllerReplication)
+						{
+							BuildAdaptiveControllerTransform(AdaptiveTransform);
+							TransformToSend = &AdaptiveTransform;
+						}
+
 						AVRBaseCharacter* OwningChar = Cast<AVRBaseCharacter>(GetOwner());
 						if (OverrideSendTransform != nullptr && OwningChar != nullptr)
 						{
-							(OwningChar->* (OverrideSendTransform))(ReplicatedControllerTransform);
+							(OwningChar->* (OverrideSendTransform))(*TransformToSend);
 						}
 						else
-							Server_SendControllerTransform(ReplicatedControllerTransform);
+							Server_SendControllerTransform(*TransformToSend);
 					}
 				}
 			}
@@ -4744,7 +5206,7 @@ void UGripMotionControllerComponent::UpdateTracking(float DeltaTime)
 			{
 				// This component could be getting accessed from the render thread so it needs to wait
 				// before clearing MotionControllerComponent and allowing the destructor to continue
-				FScopeLock ScopeLock(&CritSect);
+				FScopeLock ScopeLock(&GripViewExtension->CritSect);
 				GripViewExtension->MotionControllerComponent = NULL;
 			}
 
@@ -4756,11 +5218,38 @@ void UGripMotionControllerComponent::UpdateTracking(float DeltaTime)
 	}
 }
 
+FBPVRSnapshotBufferStats UGripMotionControllerComponent::GetSnapshotBufferStats() const
+{
+	return SnapshotBuffer.Stats;
+}
+
+void UGripMotionControllerComponent::ResetSnapshotBufferStats()
+{
+	SnapshotBuffer.ResetStats();
+}
+
 void UGripMotionControllerComponent::RunNetworkedSmoothing(float DeltaTime)
 {
 	if (bLerpingPosition)
 	{
-		if (!bUseExponentialSmoothing)
+		if (bUseSnapshotInterpolation)
+		{
+			// Plays back behind the newest snapshot every frame, stops once it settles on the newest one
+			FVector NewPosition;
+			FQuat NewRotation;
+			const double LocalTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+
+			if (!SnapshotBuffer.Sample(LocalTime, SnapshotPlayoutDelay, MaxSnapshotExtrapolationTime, NewPosition, NewRotation))
+			{
+				bLerpingPosition = false;
+			}
+
+			if (SnapshotBuffer.Num())
+			{
+				SetRelativeLocationAndRotation(NewPosition, NewRotation);
+			}
+		}
+		else if (!bUseExponentialSmoothing)
 		{
 			ControllerNetUpdateCount += DeltaTime;
 			float LerpVal = FMath::Clamp(ControllerNetUpdateCount / (1.0f / ControllerNetUpdateRate), 0.0f, 1.0f);
@@ -4799,15 +5288,37 @@ void UGripMotionControllerComponent::RunNetworkedSmoothing(float DeltaTime)
 
 			FTransform NA = FTransform(GetRelativeRotation(), GetRelativeLocation(), FVector(1.0f));
 			FTransform NB = FTransform(ReplicatedControllerTransform.Rotation, (FVector)ReplicatedControllerTransform.Position, FVector(1.0f));
+			bool bIsExtrapolating = false;
+
+			// Carry the target along the last replicated velocity until the next update comes in
+			if (bExtrapolateReplicatedMotion && LastReplicatedTransformTime >= 0.0f && GetWorld())
+			{
+				const float TimeSinceUpdate = GetWorld()->GetTimeSeconds() - LastReplicatedTransformTime;
+				const float ExtrapolationTime = FMath::Clamp(TimeSinceUpdate, 0.0f, MaxReplicatedExtrapolationTime);
+
+				if (ExtrapolationTime > 0.0f)
+				{
+					NB.AddToTranslation(ReplicatedLinearVelocity * ExtrapolationTime);
+
+					const float AngularSpeed = ReplicatedAngularVelocity.Size();
+					if (AngularSpeed > KINDA_SMALL_NUMBER)
+					{
+						NB.SetRotation(FQuat(ReplicatedAngularVelocity / AngularSpeed, AngularSpeed * ExtrapolationTime) * NB.GetRotation());
+					}
+				}
+
+				bIsExtrapolating = TimeSinceUpdate < MaxReplicatedExtrapolationTime && (!ReplicatedLinearVelocity.IsNearlyZero() || !ReplicatedAngularVelocity.IsNearlyZero());
+			}
+
 			NA.NormalizeRotation();
 			NB.NormalizeRotation();
 
 			NA.Blend(NA, NB, Alpha);
 
 			// If we are nearly equal then snap to final position
-			if (NA.EqualsNoScale(NB))
+			if (NA.EqualsNoScale(NB) && !bIsExtrapolating)
 			{
-				SetRelativeLocationAndRotation(ReplicatedControllerTransform.Position, ReplicatedControllerTransform.Rotation);
+				SetRelativeLocationAndRotation(NB.GetTranslation(), NB.Rotator());
 				bLerpingPosition = false;
 			}
 			else // Else just keep going
@@ -4852,7 +5363,16 @@ void UGripMotionControllerComponent::TickComponent(float DeltaTime, enum ELevelT
 	}*/
 
 	// Process the gripped actors
-	TickGrip(DeltaTime);
+	// When batched the grip tick subsystem runs it after every controller has updated
+	if (BatchedGripTickSubsystem.IsValid())
+	{
+		bPendingBatchedGripTick = true;
+		PendingBatchedGripDeltaTime = DeltaTime;
+	}
+	else
+	{
+		TickGrip(DeltaTime);
+	}
 }
 
 bool UGripMotionControllerComponent::GetGripWorldTransform(TArray<UVRGripScriptBase*>& GripScripts, float DeltaTime, FTransform & WorldTransform, const FTransform &ParentTransform, FBPActorGripInformation &Grip, AActor * actor, UPrimitiveComponent * root, bool bRootHasInterface, bool bActorHasInterface, bool bIsForTeleport, bool &bForceADrop)
@@ -4917,6 +5437,66 @@ bool UGripMotionControllerComponent::GetGripWorldTransform(TArray<UVRGripScriptB
 	return bHasValidTransform;
 }
 
+bool UGripMotionControllerComponent::CanBatchGripTransform(const FBPActorGripInformation& Grip) const
+{
+	// Subclasses of the default script can change the transform
+	if (!DefaultGripScript || DefaultGripScript->GetClass() != UGS_Default::StaticClass() || DefaultGripScript->Wants_ToForceDrop())
+		return false;
+
+	if (!Grip.ValueCache.bInterfaceCacheValid || Grip.ValueCache.CachedInterfaceObject != Grip.GrippedObject || Grip.ValueCache.CachedGripScripts.Num())
+		return false;
+
+	if (Grip.bIsLerping || Grip.GripCollisionType == EGripCollisionType::CustomGrip || Grip.GripCollisionType == EGripCollisionType::EventsOnly)
+		return false;
+
+	if ((Grip.SecondaryGripInfo.bHasSecondaryAttachment && Grip.SecondaryGripInfo.SecondaryAttachment) || Grip.SecondaryGripInfo.GripLerpState == EGripLerpState::EndLerp)
+		return false;
+
+	return true;
+}
+
+void UGripMotionControllerComponent::GatherBatchedGripTransforms(FGripTransformBatch& Batch)
+{
+	int32 ParentIndex = INDEX_NONE;
+
+	auto GatherArray = [&](TArray<FBPActorGripInformation>& GripArray)
+	{
+		for (FBPActorGripInformation& Grip : GripArray)
+		{
+			Grip.ValueCache.bHasBatchedWorldTransform = false;
+
+			if (Grip.bIsPaused || !Grip.IsValid() || !HasGripMovementAuthority(Grip) || !CanBatchGripTransform(Grip))
+				continue;
+
+			if (ParentIndex == INDEX_NONE)
+			{
+				ParentIndex = Batch.AddParentTransform(GetPivotTransform());
+			}
+
+			Batch.AddGrip(Grip, ParentIndex);
+		}
+	};
+
+	GatherArray(GrippedObjects);
+	GatherArray(LocallyGrippedObjects);
+}
+
+void UGripMotionControllerComponent::SetBatchedGripTickPrerequisite(FTickFunction& GrippedTickFunction, bool bAdd)
+{
+	UGripTickSubsystem* GripTickSubsystem = BatchedGripTickSubsystem.Get();
+	if (!GripTickSubsystem)
+		return;
+
+	if (bAdd)
+	{
+		GrippedTickFunction.AddPrerequisite(GripTickSubsystem, GripTickSubsystem->BatchTickFunction);
+	}
+	else
+	{
+		GrippedTickFunction.RemovePrerequisite(GripTickSubsystem, GripTickSubsystem->BatchTickFunction);
+	}
+}
+
 void UGripMotionControllerComponent::TickGrip(float DeltaTime)
 {
 	SCOPE_CYCLE_COUNTER(STAT_TickGrip);
@@ -4991,11 +5571,78 @@ FVector UGripMotionControllerComponent::GetComponentVelocity() const
 	return Super::GetComponentVelocity();
 }
 
+void UGripMotionControllerComponent::CacheGripInterfaceValues(FBPActorGripInformation& Grip, UPrimitiveComponent* root, AActor* actor)
+{
+	FBPActorGripInformation::FGripValueCache& Cache = Grip.ValueCache;
+
+	Cache.bRootHasInterface = false;
+	Cache.bActorHasInterface = false;
+	Cache.CachedBreakDistance = 0.0f;
+	Cache.CachedGripScripts.Reset();
+	Cache.CachedInterfaceObject = Grip.GrippedObject;
+	Cache.bInterfaceCacheValid = false;
+
+	if (!root || !actor)
+		return;
+
+	UObject* InterfaceObject = nullptr;
+
+	if (root->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass()))
+	{
+		Cache.bRootHasInterface = true;
+		InterfaceObject = root;
+	}
+	else if (actor->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass()))
+	{
+		// Actor grip interface is checked after component
+		Cache.bActorHasInterface = true;
+		InterfaceObject = actor;
+	}
+
+	if (InterfaceObject)
+	{
+		Cache.CachedBreakDistance = IVRGripInterface::Execute_GripBreakDistance(InterfaceObject);
+
+		TArray<UVRGripScriptBase*> GripScripts;
+		IVRGripInterface::Execute_GetGripScripts(InterfaceObject, GripScripts);
+
+		for (UVRGripScriptBase* Script : GripScripts)
+		{
+			if (Script)
+			{
+				Cache.CachedGripScripts.Add(Script);
+			}
+		}
+	}
+
+	Cache.bInterfaceCacheValid = true;
+}
+
+void UGripMotionControllerComponent::NotifyGripSettingsChanged(UObject* GrippedObject)
+{
+	for (FBPActorGripInformation& Grip : GrippedObjects)
+	{
+		if (!GrippedObject || Grip.GrippedObject == GrippedObject)
+		{
+			Grip.ValueCache.bInterfaceCacheValid = false;
+		}
+	}
+
+	for (FBPActorGripInformation& Grip : LocallyGrippedObjects)
+	{
+		if (!GrippedObject || Grip.GrippedObject == GrippedObject)
+		{
+			Grip.ValueCache.bInterfaceCacheValid = false;
+		}
+	}
+}
+
 void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformation> &GrippedObjectsArray, const FTransform & ParentTransform, float DeltaTime, bool bReplicatedArray)
 {
 	if (GrippedObjectsArray.Num())
 	{
 		FTransform WorldTransform;
+		const bool bCacheInterfaceValues = GetDefault<UVRGlobalSettings>()->bCacheGripInterfaceValues;
 
 		for (int i = GrippedObjectsArray.Num() - 1; i >= 0; --i)
 		{
@@ -5059,8 +5706,19 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 				// Check if either implements the interface
 				bool bRootHasInterface = false;
 				bool bActorHasInterface = false;
-				
-				if (root->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass()))
+
+				if (bCacheInterfaceValues)
+				{
+					// Interface values are cached at grip time, only re-resolve them if they were invalidated
+					if (!Grip->ValueCache.bInterfaceCacheValid || Grip->ValueCache.CachedInterfaceObject != Grip->GrippedObject)
+					{
+						CacheGripInterfaceValues(*Grip, root, actor);
+					}
+
+					bRootHasInterface = Grip->ValueCache.bRootHasInterface;
+					bActorHasInterface = Grip->ValueCache.bActorHasInterface;
+				}
+				else if (root->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass()))
 				{
 					bRootHasInterface = true;
 				}
@@ -5083,9 +5741,20 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 
 				bool bRescalePhysicsGrips = false;
 				
-				TArray<UVRGripScriptBase*> GripScripts;
+				TArray<UVRGripScriptBase*>& GripScripts = TickGripScripts;
+				GripScripts.Reset();
 
-				if (bRootHasInterface)
+				if (bCacheInterfaceValues)
+				{
+					for (const FWeakObjectPtr& CachedScript : Grip->ValueCache.CachedGripScripts)
+					{
+						if (UVRGripScriptBase* Script = Cast<UVRGripScriptBase>(CachedScript.Get()))
+						{
+							GripScripts.Add(Script);
+						}
+					}
+				}
+				else if (bRootHasInterface)
 				{
 					IVRGripInterface::Execute_GetGripScripts(root, GripScripts);
 				}
@@ -5096,9 +5765,27 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 
 
 				bool bForceADrop = false;
+				bool bHasValidWorldTransform = false;
 
-				// Get the world transform for this grip after handling secondary grips and interaction differences
-				bool bHasValidWorldTransform = GetGripWorldTransform(GripScripts, DeltaTime, WorldTransform, ParentTransform, *Grip, actor, root, bRootHasInterface, bActorHasInterface, false, bForceADrop);
+				// The grip tick subsystem already solved the default transform for this grip, re-check in case something
+				// changed on it between the batch and now
+				if (Grip->ValueCache.bHasBatchedWorldTransform && !GripScripts.Num() && CanBatchGripTransform(*Grip))
+				{
+					WorldTransform = Grip->ValueCache.BatchedWorldTransform;
+					bHasValidWorldTransform = WorldTransform.IsValid();
+
+					if (!bHasValidWorldTransform)
+					{
+						UE_LOG(LogVRMotionController, Warning, TEXT("Something went wrong, the batched grip transform was NAN!."));
+					}
+				}
+				else
+				{
+					// Get the world transform for this grip after handling secondary grips and interaction differences
+					bHasValidWorldTransform = GetGripWorldTransform(GripScripts, DeltaTime, WorldTransform, ParentTransform, *Grip, actor, root, bRootHasInterface, bActorHasInterface, false, bForceADrop);
+				}
+
+				Grip->ValueCache.bHasBatchedWorldTransform = false;
 
 				// If a script or behavior is telling us to skip this and continue on (IE: it dropped the grip)
 				if (bForceADrop)
@@ -5171,7 +5858,11 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 					else
 					{
 						float BreakDistance = 0.0f;
-						if (bRootHasInterface)
+						if (bCacheInterfaceValues)
+						{
+							BreakDistance = Grip->ValueCache.CachedBreakDistance;
+						}
+						else if (bRootHasInterface)
 						{
 							BreakDistance = IVRGripInterface::Execute_GripBreakDistance(root);
 						}
@@ -5451,18 +6142,7 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 						// Make sure that there is no collision on course before turning off collision and snapping to controller
 						FBPActorPhysicsHandleInformation * GripHandle = GetPhysicsGrip(*Grip);
 
-						TArray<FHitResult> Hits;
-						FComponentQueryParams Params(NAME_None, this->GetOwner());
-						//Params.bTraceAsyncScene = root->bCheckAsyncSceneOnMove;
-						Params.AddIgnoredActor(actor);
-						Params.AddIgnoredActors(root->MoveIgnoreActors);
-
-						actor->ForEachAttachedActors([&Params](AActor* Actor)
-						{
-							Params.AddIgnoredActor(Actor);
-							return true;
-						});
-
+						TArray<FHitResult>& Hits = GripSweepHits;
 						FTransform BaseTransform = root->GetComponentTransform();
 
 						if (bProjectNonSimulatingGrips && !Grip->bColliding && Grip->bSetLastWorldTransform)
@@ -5486,10 +6166,29 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 							bDistanceBasedInterpolation = VRSettings->bHybridWithSweepUseDistanceBasedLerp;
 						}
 
+						const bool bBatchSweeps = VRSettings && VRSettings->bBatchGripSweepsInEndPhysics;
+
+						FComponentQueryParams Params(NAME_None, this->GetOwner());
+						if (!bBatchSweeps)
+						{
+							InitHybridSweepParams(Params, actor, root);
+						}
+
 						if (Grip->bLockHybridGrip)
 						{
 							Grip->bColliding = true;
 						}
+						else if (bBatchSweeps)
+						{
+							// Take the result of last frames batched sweep and queue up this frames
+							if (Grip->ValueCache.bHasBatchedSweepResult)
+							{
+								Grip->bColliding = Grip->ValueCache.bBatchedSweepHit;
+								Grip->ValueCache.bHasBatchedSweepResult = false;
+							}
+
+							QueueGripSweep(Grip->GripID, root, BaseTransform.GetLocation(), WorldTransform.GetLocation(), WorldTransform.GetRotation(), true, bLerpCollisions, root->GetComponentQuat());
+						}
 						// Check our target rotation
 						else if (GetWorld()->ComponentSweepMulti(Hits, root, BaseTransform.GetLocation(), WorldTransform.GetLocation(), WorldTransform.GetRotation(), Params) && FHitResult::GetFirstBlockingHit(Hits) != nullptr)
 						{
@@ -5718,6 +6417,16 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 
 						root->ComponentVelocity = (NewPosition - OriginalPosition) / DeltaTime;
 
+						const UVRGlobalSettings* VRSettings = GetDefault<UVRGlobalSettings>();
+						const bool bBatchSweeps = VRSettings && VRSettings->bBatchGripSweepsInEndPhysics;
+
+						// Take the result of last frames batched sweep
+						if (bBatchSweeps && Grip->ValueCache.bHasBatchedSweepResult)
+						{
+							Grip->bColliding = Grip->ValueCache.bBatchedSweepHit;
+							Grip->ValueCache.bHasBatchedSweepResult = false;
+						}
+
 						// Now sweep collision separately so we can get hits but not have the location altered
 						if (bUseWithoutTracking || NewPosition != OriginalPosition || NewOrientation != OriginalOrientation)
 						{
@@ -5726,7 +6435,22 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 							// ComponentSweepMulti does nothing if moving < UE_KINDA_SMALL_NUMBER in distance, so it's important to not try to sweep distances smaller than that. 
 							const float MinMovementDistSq = (FMath::Square(4.f*UE_KINDA_SMALL_NUMBER));
 
-							if (bUseWithoutTracking || move.SizeSquared() > MinMovementDistSq || NewOrientation != OriginalOrientation)
+							if (bBatchSweeps && (bUseWithoutTracking || move.SizeSquared() > MinMovementDistSq || NewOrientation != OriginalOrientation))
+							{
+								// Queue the sweeps from where we are now, they get resolved in the end physics tick
+								QueueGripSweep(Grip->GripID, root, OriginalPosition, OriginalPosition + move, OriginalOrientation.Quaternion(), false);
+
+								root->GetChildrenComponents(true, GripSweepChildren);
+								for (USceneComponent* Prim : GripSweepChildren)
+								{
+									if (UPrimitiveComponent* primComp = Cast<UPrimitiveComponent>(Prim))
+									{
+										FVector ChildLocation = primComp->GetComponentLocation();
+										QueueGripSweep(INVALID_VRGRIP_ID, primComp, ChildLocation, ChildLocation + move, primComp->GetComponentQuat(), false);
+									}
+								}
+							}
+							else if (bUseWithoutTracking || move.SizeSquared() > MinMovementDistSq || NewOrientation != OriginalOrientation)
 							{
 								if (CheckComponentWithSweep(root, move, OriginalOrientation, false))
 								{
@@ -5873,6 +6597,7 @@ void UGripMotionControllerComponent::CleanUpBadGrip(TArray<FBPActorGripInformati
 				// Need to delete it from the physics thread
 				DestroyPhysicsHandle(&PhysicsGrips[g]);
 				PhysicsGrips.RemoveAt(g);
+				MarkPhysicsGripIndexDirty();
 			}
 		}
 	}
@@ -5894,15 +6619,14 @@ void UGripMotionControllerComponent::CleanUpBadPhysicsHandles()
 	// Clean up tailing physics handles with null objects
 	for (int g = PhysicsGrips.Num() - 1; g >= 0; --g)
 	{
-		FBPActorGripInformation * GripInfo = LocallyGrippedObjects.FindByKey(PhysicsGrips[g].GripID);
-		if(!GripInfo)
-			GrippedObjects.FindByKey(PhysicsGrips[g].GripID);
+		FBPActorGripInformation * GripInfo = FindGripByID(PhysicsGrips[g].GripID);
 
 		if (!GripInfo)
 		{
 			// Need to delete it from the physics thread
 			DestroyPhysicsHandle(&PhysicsGrips[g]);
 			PhysicsGrips.RemoveAt(g);
+			MarkPhysicsGripIndexDirty();
 		}
 	}
 }
@@ -6013,17 +6737,131 @@ bool UGripMotionControllerComponent::DestroyPhysicsHandle(FBPActorPhysicsHandleI
 
 	if (!HandleInfo->bSkipDeletingKinematicActor)
 	{
-		if (FPhysicsInterface::IsValid(HandleInfo->KinActorData2))
+		ReleasePhysicsHandleAnchor(HandleInfo->KinActorData2);
+	}
+
+	return true;
+}
+
+FPhysicsActorHandle UGripMotionControllerComponent::CreatePhysicsHandleAnchor(FPhysScene* Scene, const FTransform& KinPose)
+{
+	FPhysicsActorHandle Anchor = nullptr;
+
+	FActorCreationParams ActorParams;
+	ActorParams.InitialTM = KinPose;
+	ActorParams.DebugName = nullptr;
+	ActorParams.bEnableGravity = false;
+	ActorParams.bQueryOnly = false;// true; // True or false?
+	ActorParams.bStatic = false;
+	ActorParams.Scene = Scene;
+	FPhysicsInterface::CreateActor(ActorParams, Anchor);
+
+	if (FPhysicsInterface::IsValid(Anchor))
+	{
+		FPhysicsInterface::SetMass_AssumesLocked(Anchor, 1.0f);
+		FPhysicsInterface::SetMassSpaceInertiaTensor_AssumesLocked(Anchor, FVector(1.f));
+		FPhysicsInterface::SetIsKinematic_AssumesLocked(Anchor, true);
+		FPhysicsInterface::SetMaxDepenetrationVelocity_AssumesLocked(Anchor, MAX_FLT);
+		//FPhysicsInterface::SetActorUserData_AssumesLocked(Anchor, NULL);
+	}
+
+	using namespace Chaos;
+	// Missing from physx, not sure how it is working for them currently.
+	//TArray<FPhysicsActorHandle> ActorHandles;
+	Anchor->GetGameThreadAPI().SetGeometry(TUniquePtr<FImplicitObject>(new TSphere<FReal, 3>(TVector<FReal, 3>(0.f), 1000.f)));
+	Anchor->GetGameThreadAPI().SetObjectState(EObjectStateType::Kinematic);
+	FPhysicsInterface::AddActorToSolver(Anchor, ActorParams.Scene->GetSolver());
+	//ActorHandles.Add(Anchor);
+	//ActorParams.Scene->AddActorsToScene_AssumesLocked(ActorHandles);
+
+	return Anchor;
+}
+
+FPhysicsActorHandle UGripMotionControllerComponent::AcquirePhysicsHandleAnchor(FPhysScene* Scene, const FTransform& KinPose)
+{
+	while (PhysicsHandleAnchorPool.Num())
+	{
+		FPhysicsActorHandle Anchor = PhysicsHandleAnchorPool.Pop(false);
+
+		if (!FPhysicsInterface::IsValid(Anchor))
+			continue;
+
+		// Left over from a different scene, can't use it here
+		if (FPhysicsInterface::GetCurrentScene(Anchor) != Scene)
 		{
-			FPhysicsActorHandle ActorHandle = HandleInfo->KinActorData2;
+			FPhysicsInterface::ReleaseActor(Anchor, FPhysicsInterface::GetCurrentScene(Anchor));
+			continue;
+		}
+
+		// Teleport it to where a new one would have been created
+		FPhysicsInterface::SetGlobalPose_AssumesLocked(Anchor, KinPose);
+		return Anchor;
+	}
+
+	return CreatePhysicsHandleAnchor(Scene, KinPose);
+}
+
+void UGripMotionControllerComponent::ReleasePhysicsHandleAnchor(FPhysicsActorHandle& Anchor)
+{
+	if (FPhysicsInterface::IsValid(Anchor))
+	{
+		if (PhysicsHandleAnchorPool.Num() < PhysicsHandlePoolSize)
+		{
+			PhysicsHandleAnchorPool.Add(Anchor);
+		}
+		else
+		{
+			FPhysicsActorHandle ActorHandle = Anchor;
 			FPhysicsCommand::ExecuteWrite(ActorHandle, [&](const FPhysicsActorHandle& Actor)
 			{
-					FPhysicsInterface::ReleaseActor(HandleInfo->KinActorData2, FPhysicsInterface::GetCurrentScene(HandleInfo->KinActorData2));
+					FPhysicsInterface::ReleaseActor(Anchor, FPhysicsInterface::GetCurrentScene(Anchor));
 			});
 		}
 	}
 
-	return true;
+	Anchor = nullptr;
+}
+
+void UGripMotionControllerComponent::PrewarmPhysicsHandlePool()
+{
+	UWorld* World = GetWorld();
+	FPhysScene* Scene = World ? World->GetPhysicsScene() : nullptr;
+
+	if (!Scene || PhysicsHandleAnchorPool.Num() >= PhysicsHandlePoolSize)
+		return;
+
+	FTransform KinPose = GetPivotTransform();
+	KinPose.SetScale3D(FVector(1.0f));
+
+	FPhysicsCommand::ExecuteWrite(Scene, [&]()
+	{
+		while (PhysicsHandleAnchorPool.Num() < PhysicsHandlePoolSize)
+		{
+			FPhysicsActorHandle Anchor = CreatePhysicsHandleAnchor(Scene, KinPose);
+
+			if (!FPhysicsInterface::IsValid(Anchor))
+				break;
+
+			PhysicsHandleAnchorPool.Add(Anchor);
+		}
+	});
+}
+
+void UGripMotionControllerComponent::EmptyPhysicsHandlePool()
+{
+	for (FPhysicsActorHandle& Anchor : PhysicsHandleAnchorPool)
+	{
+		if (FPhysicsInterface::IsValid(Anchor))
+		{
+			FPhysicsActorHandle ActorHandle = Anchor;
+			FPhysicsCommand::ExecuteWrite(ActorHandle, [&](const FPhysicsActorHandle& Actor)
+			{
+					FPhysicsInterface::ReleaseActor(Anchor, FPhysicsInterface::GetCurrentScene(Anchor));
+			});
+		}
+	}
+
+	PhysicsHandleAnchorPool.Empty();
 }
 
 bool UGripMotionControllerComponent::DestroyPhysicsHandle(const FBPActorGripInformation &Grip, bool bSkipUnregistering)
@@ -6082,7 +6920,10 @@ bool UGripMotionControllerComponent::DestroyPhysicsHandle(const FBPActorGripInfo
 
 	int index;
 	if (GetPhysicsGripIndex(Grip, index))
+	{
 		PhysicsGrips.RemoveAt(index);
+		MarkPhysicsGripIndexDirty();
+	}
 
 	return true;
 }
@@ -6330,34 +7171,8 @@ bool UGripMotionControllerComponent::SetUpPhysicsHandle(const FBPActorGripInform
 		
 		if (!FPhysicsInterface::IsValid(HandleInfo->KinActorData2))
 		{
-			// Create kinematic actor we are going to create joint with. This will be moved around with calls to SetLocation/SetRotation.
-			
-			FActorCreationParams ActorParams;
-			ActorParams.InitialTM = KinPose;
-			ActorParams.DebugName = nullptr;
-			ActorParams.bEnableGravity = false;
-			ActorParams.bQueryOnly = false;// true; // True or false?
-			ActorParams.bStatic = false;
-			ActorParams.Scene = FPhysicsInterface::GetCurrentScene(Actor);
-			FPhysicsInterface::CreateActor(ActorParams, HandleInfo->KinActorData2);
-			
-			if (FPhysicsInterface::IsValid(HandleInfo->KinActorData2))
-			{
-				FPhysicsInterface::SetMass_AssumesLocked(HandleInfo->KinActorData2, 1.0f);
-				FPhysicsInterface::SetMassSpaceInertiaTensor_AssumesLocked(HandleInfo->KinActorData2, FVector(1.f));
-				FPhysicsInterface::SetIsKinematic_AssumesLocked(HandleInfo->KinActorData2, true);
-				FPhysicsInterface::SetMaxDepenetrationVelocity_AssumesLocked(HandleInfo->KinActorData2, MAX_FLT);
-				//FPhysicsInterface::SetActorUserData_AssumesLocked(HandleInfo->KinActorData2, NULL);
-			}
-
-			using namespace Chaos;
-			// Missing from physx, not sure how it is working for them currently.
-			//TArray<FPhysicsActorHandle> ActorHandles;
-			HandleInfo->KinActorData2->GetGameThreadAPI().SetGeometry(TUniquePtr<FImplicitObject>(new TSphere<FReal, 3>(TVector<FReal, 3>(0.f), 1000.f)));
-			HandleInfo->KinActorData2->GetGameThreadAPI().SetObjectState(EObjectStateType::Kinematic);
-			FPhysicsInterface::AddActorToSolver(HandleInfo->KinActorData2, ActorParams.Scene->GetSolver());
-			//ActorHandles.Add(HandleInfo->KinActorData2);
-			//ActorParams.Scene->AddActorsToScene_AssumesLocked(ActorHandles);
+			// Get the kinematic actor we are going to create joint with, re-uses a pooled one if there is one. This will be moved around with calls to SetLocation/SetRotation.
+			HandleInfo->KinActorData2 = AcquirePhysicsHandleAnchor(FPhysicsInterface::GetCurrentScene(Actor), KinPose);
 		}
 
 		// If we don't already have a handle - make one now.
@@ -6383,19 +7198,36 @@ bool UGripMotionControllerComponent::SetUpPhysicsHandle(const FBPActorGripInform
 			FTransform newTrans = HandleInfo->COMPosition * (HandleInfo->RootBoneRotation * HandleInfo->LastPhysicsTransform);
 			*/
 
-			// There isn't a direct set for the particles, so keep it as a recreation instead.
-			FPhysicsInterface::ReleaseConstraint(HandleInfo->HandleData2);
-
+			FTransform TargetTrans;
 			if (!NewGrip.bIsLerping && bConstrainToPivot)
 			{
-				FTransform TargetTrans(NewGrip.RelativeTransform.ToMatrixNoScale().Inverse());
-				HandleInfo->HandleData2 = FPhysicsInterface::CreateConstraint(HandleInfo->KinActorData2, Actor, FTransform::Identity, TargetTrans);
+				TargetTrans = FTransform(NewGrip.RelativeTransform.ToMatrixNoScale().Inverse());
 			}
 			else
 			{
-				HandleInfo->HandleData2 = FPhysicsInterface::CreateConstraint(HandleInfo->KinActorData2, Actor, FTransform::Identity, KinPose.GetRelativeTransform(FPhysicsInterface::GetGlobalPose_AssumesLocked(Actor)));
+				TargetTrans = KinPose.GetRelativeTransform(FPhysicsInterface::GetGlobalPose_AssumesLocked(Actor));
+			}
+
+			// Re-target the existing joint in place instead of releasing it and creating a new one on the physics thread
+			// Only if it is still between the same particles, there isn't a safe direct set for them on a live joint
+			Chaos::FConstraintBase* ConstraintHandle = HandleInfo->HandleData2.Constraint;
+			bool bCanRetargetConstraint = false;
+			if (ConstraintHandle && ConstraintHandle->IsType(Chaos::EConstraintType::JointConstraintType))
+			{
+				const auto ParticleProxies = ((Chaos::FJointConstraint*)ConstraintHandle)->GetParticleProxies();
+				bCanRetargetConstraint = ParticleProxies[0] == HandleInfo->KinActorData2 && ParticleProxies[1] == Actor;
+			}
+
+			if (bCanRetargetConstraint)
+			{
+				FPhysicsInterface::SetLocalPose(HandleInfo->HandleData2, FTransform::Identity, EConstraintFrame::Frame1);
+				FPhysicsInterface::SetLocalPose(HandleInfo->HandleData2, TargetTrans, EConstraintFrame::Frame2);
+			}
+			else
+			{
+				FPhysicsInterface::ReleaseConstraint(HandleInfo->HandleData2);
+				HandleInfo->HandleData2 = FPhysicsInterface::CreateConstraint(HandleInfo->KinActorData2, Actor, FTransform::Identity, TargetTrans);
 			}
-		
 		}
 
 		if (HandleInfo->HandleData2.IsValid())
@@ -6860,7 +7692,17 @@ static void PullBackHitComp(FHitResult& Hit, const FVector& Start, const FVector
 
 bool UGripMotionControllerComponent::CheckComponentWithSweep(UPrimitiveComponent * ComponentToCheck, FVector Move, FRotator newOrientation, bool bSkipSimulatingComponents/*,  bool &bHadBlockingHitOut*/)
 {
-	TArray<FHitResult> Hits;
+	if (!ComponentToCheck)
+		return false;
+
+	return CheckComponentWithSweepFrom(ComponentToCheck, ComponentToCheck->GetComponentLocation(), Move, newOrientation, bSkipSimulatingComponents);
+}
+
+bool UGripMotionControllerComponent::CheckComponentWithSweepFrom(UPrimitiveComponent* ComponentToCheck, const FVector& Start, FVector Move, FRotator newOrientation, bool bSkipSimulatingComponents)
+{
+	// Re-using the buffer, the blocking hit is copied out before we dispatch anything
+	TArray<FHitResult>& Hits = GripSweepHits;
+	Hits.Reset();
 	// WARNING: HitResult is only partially initialized in some paths. All data is valid only if bFilledHitResult is true.
 	FHitResult BlockingHit(NoInit);
 	BlockingHit.bBlockingHit = false;
@@ -6875,7 +7717,7 @@ bool UGripMotionControllerComponent::CheckComponentWithSweep(UPrimitiveComponent
 	if (!root || !root->IsQueryCollisionEnabled())
 		return false;
 
-	FVector start(root->GetComponentLocation());
+	FVector start(Start);
 
 	const bool bCollisionEnabled = root->IsQueryCollisionEnabled();
 
@@ -7068,15 +7910,43 @@ void UGripMotionControllerComponent::ApplyTrackingParameters(FVector& OriginalPo
 
 void UGripMotionControllerComponent::OnModularFeatureUnregistered(const FName& Type, class IModularFeature* ModularFeature)
 {
-	FScopeLock Lock(&GripPolledMotionControllerMutex);
+	IMotionController* ExpectedController = static_cast<IMotionController*>(ModularFeature);
+	GripPolledMotionController_GameThread.compare_exchange_strong(ExpectedController, nullptr);
 
-	if (ModularFeature == GripPolledMotionController_GameThread)
+	// The render thread doesn't lock while it uses its copy, so clear it in order and wait for it to be done with it
+	ENQUEUE_RENDER_COMMAND(ClearGripPolledMotionControllerCommand)(
+		[this, ModularFeature](FRHICommandListImmediate& RHICmdList)
+		{
+			if (ModularFeature == GripPolledMotionController_RenderThread)
+			{
+				GripPolledMotionController_RenderThread = nullptr;
+			}
+		});
+
+	if (IsInGameThread())
+	{
+		FlushRenderingCommands();
+	}
+}
+
+void UGripMotionControllerComponent::GetLateUpdateHandoffStats(int32& FramesSkippedForTeardown, int32& FramesWithoutController) const
+{
+	FramesSkippedForTeardown = 0;
+	FramesWithoutController = 0;
+
+	if (GripViewExtension.IsValid())
 	{
-		GripPolledMotionController_GameThread = nullptr;
+		FramesSkippedForTeardown = GripViewExtension->FramesSkippedForTeardown.load(std::memory_order_relaxed);
+		FramesWithoutController = GripViewExtension->FramesWithoutController.load(std::memory_order_relaxed);
 	}
-	if (ModularFeature == GripPolledMotionController_RenderThread)
+}
+
+void UGripMotionControllerComponent::ResetLateUpdateHandoffStats()
+{
+	if (GripViewExtension.IsValid())
 	{
-		GripPolledMotionController_RenderThread = nullptr;
+		GripViewExtension->FramesSkippedForTeardown.store(0, std::memory_order_relaxed);
+		GripViewExtension->FramesWithoutController.store(0, std::memory_order_relaxed);
 	}
 }
 
@@ -7090,20 +7960,13 @@ bool UGripMotionControllerComponent::GripPollControllerState(FVector& Position,
 
 	if (bHasAuthority)
 	{
-		GripUEMotionController::FScopeLockOptional LockOptional;
-
 		TArray<IMotionController*> MotionControllers;
 		if (IsInGameThread())
 		{
 			MotionControllers = IModularFeatures::Get().GetModularFeatureImplementations<IMotionController>(IMotionController::GetModularFeatureName());
-			{
-				FScopeLock Lock(&GripPolledMotionControllerMutex);
-				GripPolledMotionController_GameThread = nullptr;
-			}
 		}
 		else if (IsInRenderingThread())
 		{
-			LockOptional.Lock(&GripPolledMotionControllerMutex);
 			if (GripPolledMotionController_RenderThread != nullptr)
 			{
 				MotionControllers.Add(GripPolledMotionController_RenderThread);
@@ -7173,10 +8036,8 @@ bool UGripMotionControllerComponent::GripPollControllerState(FVector& Position,
 					OnMotionControllerUpdated();
 					InUseMotionController = nullptr;
 
-					{
-						FScopeLock Lock(&GripPolledMotionControllerMutex);
-						GripPolledMotionController_GameThread = MotionController;  // We only want a render thread update from the motion controller we polled on the game thread.
-					}
+					// We only want a render thread update from the motion controller we polled on the game thread.
+					GripPolledMotionController_GameThread.store(MotionController, std::memory_order_release);
 				}
 							
 				return true;
@@ -7190,6 +8051,12 @@ bool UGripMotionControllerComponent::GripPollControllerState(FVector& Position,
 			#endif*/
 		}
 
+		// Didn't find a controller this frame, don't let the render thread keep using the last one
+		if (bIsInGameThread)
+		{
+			GripPolledMotionController_GameThread.store(nullptr, std::memory_order_release);
+		}
+
 		// #NOTE: This was adding in 4.20, I presume to allow for HMDs as tracking sources for mixed reality.
 		// Skipping all of my special logic here for now
 		if (MotionSource == FXRMotionControllerBase::HMDSourceId)
@@ -7233,14 +8100,23 @@ void UGripMotionControllerComponent::FGripViewExtension::PreRenderViewFamily_Ren
 	FTransform NewTransform;
 
 	{
-		FScopeLock ScopeLock(&CritSect);
+		// The game thread only holds this extensions lock while tearing its own component down, skip the frame instead of blocking on it
+		FScopeTryLock ScopeLock(&CritSect);
+
+		if (!ScopeLock.IsLocked())
+		{
+			FramesSkippedForTeardown.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
 
 		if (!MotionControllerComponent)
 			return;
 
+		MotionControllerComponent->GripPolledMotionController_RenderThread = MotionControllerComponent->GripPolledMotionController_GameThread.load(std::memory_order_acquire);
+
+		if (!MotionControllerComponent->GripPolledMotionController_RenderThread)
 		{
-			FScopeLock Lock(&MotionControllerComponent->GripPolledMotionControllerMutex);
-			MotionControllerComponent->GripPolledMotionController_RenderThread = MotionControllerComponent->GripPolledMotionController_GameThread;
+			FramesWithoutController.fetch_add(1, std::memory_order_relaxed);
 		}
 
 		// Find a view that is associated with this player.
@@ -7629,6 +8505,7 @@ void UGripMotionControllerComponent::Server_NotifyLocalGripAddedOrChanged_Implem
 		}
 
 		int32 NewIndex = LocallyGrippedObjects.Add(newGrip);
+		MarkGripIndexDirty();
 
 		if (NewIndex != INDEX_NONE && LocallyGrippedObjects.Num() > 0)
 		{
@@ -7656,6 +8533,7 @@ void UGripMotionControllerComponent::Server_NotifyLocalGripAddedOrChanged_Implem
 		{
 			FBPActorGripInformation OriginalGrip = LocallyGrippedObjects[IndexFound];
 			LocallyGrippedObjects[IndexFound].RepCopy(newGrip);
+			MarkGripIndexDirty();
 			HandleGripReplication(LocallyGrippedObjects[IndexFound], &OriginalGrip);
 		}
 	}
@@ -7820,6 +8698,11 @@ void FExpandedLateUpdateManager::Setup(const FTransform& ParentToWorld, UGripMot
 	UpdateStates[LateUpdateGameWriteIndex].Primitives.Reset();
 	UpdateStates[LateUpdateGameWriteIndex].ParentToWorld = ParentToWorld;
 
+	for (TPair<const USceneComponent*, FLateUpdateHierarchyCache>& CachePair : HierarchyCache)
+	{
+		CachePair.Value.bUsedThisFrame = false;
+	}
+
 	//Add additional late updates registered to this controller that aren't children and aren't gripped
 	//This array is editable in blueprint and can be used for things like arms or the like.
 	for (UPrimitiveComponent* primComp : Component->AdditionalLateUpdateComponents)
@@ -7834,6 +8717,33 @@ void FExpandedLateUpdateManager::Setup(const FTransform& ParentToWorld, UGripMot
 	GatherLateUpdatePrimitives(Component);
 	//GatherLateUpdatePrimitives(Component);
 
+	// Drop hierarchies that we didn't gather from this frame (released grips, removed additional components)
+	for (TMap<const USceneComponent*, FLateUpdateHierarchyCache>::TIterator It(HierarchyCache); It; ++It)
+	{
+		if (!It.Value().bUsedThisFrame)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Sort and remove duplicates so that the render thread can binary search the list if scene indices change
+	TArray<FLateUpdatePrimitiveInfo>& Primitives = UpdateStates[LateUpdateGameWriteIndex].Primitives;
+	if (Primitives.Num() > 1)
+	{
+		Primitives.Sort([](const FLateUpdatePrimitiveInfo& A, const FLateUpdatePrimitiveInfo& B) { return A.SceneInfo < B.SceneInfo; });
+
+		int32 WriteIndex = 1;
+		for (int32 ReadIndex = 1; ReadIndex < Primitives.Num(); ++ReadIndex)
+		{
+			if (Primitives[ReadIndex].SceneInfo != Primitives[WriteIndex - 1].SceneInfo)
+			{
+				Primitives[WriteIndex++] = Primitives[ReadIndex];
+			}
+		}
+
+		Primitives.SetNum(WriteIndex, false);
+	}
+
 	UpdateStates[LateUpdateGameWriteIndex].bSkip = bSkipLateUpdate;
 	++UpdateStates[LateUpdateGameWriteIndex].TrackingNumber;
 
@@ -7872,13 +8782,14 @@ void FExpandedLateUpdateManager::Apply_RenderThread(FSceneInterface* Scene, cons
 	// Since the list is very small(only affect stuff attaching to the controller),  we just make a local copy PrimitivesLocal.
 	TMap<FPrimitiveSceneInfo*, int32> PrimitivesLocal = UpdateStates[LateUpdateRenderReadIndex].Primitives;
 	for (auto& PrimitivePair : PrimitivesLocal)*/
-	for (auto& PrimitivePair : UpdateStates[LateUpdateRenderReadIndex].Primitives)
+	TArray<FLateUpdatePrimitiveInfo>& Primitives = UpdateStates[LateUpdateRenderReadIndex].Primitives;
+	for (FLateUpdatePrimitiveInfo& PrimitiveInfo : Primitives)
 	{
-		if (PrimitivePair.Value == -1)
+		if (PrimitiveInfo.Index == -1)
 			continue;
 
-		FPrimitiveSceneInfo* RetrievedSceneInfo = Scene->GetPrimitiveSceneInfo(PrimitivePair.Value);
-		FPrimitiveSceneInfo* CachedSceneInfo = PrimitivePair.Key;
+		FPrimitiveSceneInfo* RetrievedSceneInfo = Scene->GetPrimitiveSceneInfo(PrimitiveInfo.Index);
+		FPrimitiveSceneInfo* CachedSceneInfo = PrimitiveInfo.SceneInfo;
 
 		// If the retrieved scene info is different than our cached scene info then the scene has changed in the meantime
 		// and we need to search through the entire scene to make sure it still exists.
@@ -7890,7 +8801,7 @@ void FExpandedLateUpdateManager::Apply_RenderThread(FSceneInterface* Scene, cons
 		else if (CachedSceneInfo->Proxy)
 		{
 			CachedSceneInfo->Proxy->ApplyLateUpdateTransform(LateUpdateTransform);
-			PrimitivePair.Value = -1; // Set the cached index to -1 to indicate that this primitive was already processed
+			PrimitiveInfo.Index = -1; // Set the cached index to -1 to indicate that this primitive was already processed
 			/*if (FrameNumber >= 0)
 			{
 				CachedSceneInfo->Proxy->SetPatchingFrameNumber(FrameNumber);
@@ -7907,7 +8818,8 @@ void FExpandedLateUpdateManager::Apply_RenderThread(FSceneInterface* Scene, cons
 		{
 			/*int32* PrimitiveIndex = PrimitivesLocal.Find(RetrievedSceneInfo);
 			if (RetrievedSceneInfo->Proxy && PrimitiveIndex != nullptr && *PrimitiveIndex >= 0)*/
-			if (RetrievedSceneInfo->Proxy && UpdateStates[LateUpdateRenderReadIndex].Primitives.Contains(RetrievedSceneInfo) && UpdateStates[LateUpdateRenderReadIndex].Primitives[RetrievedSceneInfo] >= 0)
+			int32 FoundIndex = RetrievedSceneInfo->Proxy ? Algo::BinarySearchBy(Primitives, RetrievedSceneInfo, &FLateUpdatePrimitiveInfo::SceneInfo) : INDEX_NONE;
+			if (FoundIndex != INDEX_NONE && Primitives[FoundIndex].Index >= 0)
 			{
 				RetrievedSceneInfo->Proxy->ApplyLateUpdateTransform(LateUpdateTransform);
 				/*if (FrameNumber >= 0)
@@ -7930,30 +8842,70 @@ void FExpandedLateUpdateManager::CacheSceneInfo(USceneComponent* Component)
 		FPrimitiveSceneInfo* PrimitiveSceneInfo = PrimitiveComponent->SceneProxy->GetPrimitiveSceneInfo();
 		if (PrimitiveSceneInfo && PrimitiveSceneInfo->IsIndexValid())
 		{
-			UpdateStates[LateUpdateGameWriteIndex].Primitives.Emplace(PrimitiveSceneInfo, PrimitiveSceneInfo->GetIndex());
+			UpdateStates[LateUpdateGameWriteIndex].Primitives.Add({ PrimitiveSceneInfo, PrimitiveSceneInfo->GetIndex() });
 		}
 	}
 }
 
 void FExpandedLateUpdateManager::GatherLateUpdatePrimitives(USceneComponent* ParentComponent)
 {
-	CacheSceneInfo(ParentComponent);
-	TArray<USceneComponent*> DirectComponents;
+	FLateUpdateHierarchyCache& Cache = HierarchyCache.FindOrAdd(ParentComponent);
+	Cache.bUsedThisFrame = true;
+
+	// Only walk the hierarchy again if something was attached or detached since last time
+	if (!Cache.Components.Num() || !IsHierarchyCacheValid(Cache))
+	{
+		RebuildHierarchyCache(ParentComponent, Cache);
+	}
 
 	// Std late updates
-	ParentComponent->GetChildrenComponents(true, DirectComponents);
-	for (USceneComponent* Component : DirectComponents)
+	for (const FLateUpdateCachedComponent& CachedComponent : Cache.Components)
 	{
-		if (Component != nullptr)
+		if (USceneComponent* Component = CachedComponent.Component.Get())
 		{
 			CacheSceneInfo(Component);
 		}
 	}
 }
 
+bool FExpandedLateUpdateManager::IsHierarchyCacheValid(const FLateUpdateHierarchyCache& Cache) const
+{
+	for (int32 i = 0; i < Cache.Components.Num(); ++i)
+	{
+		const FLateUpdateCachedComponent& CachedComponent = Cache.Components[i];
+		const USceneComponent* Component = CachedComponent.Component.Get();
+
+		if (!Component || Component->GetAttachChildren().Num() != CachedComponent.NumAttachChildren)
+			return false;
+
+		// The root is allowed to move around, we only care about what is under it
+		if (i > 0 && Component->GetAttachParent() != CachedComponent.AttachParent)
+			return false;
+	}
+
+	return true;
+}
+
+void FExpandedLateUpdateManager::RebuildHierarchyCache(USceneComponent* ParentComponent, FLateUpdateHierarchyCache& Cache)
+{
+	Cache.Components.Reset();
+	Cache.Components.Add({ ParentComponent, ParentComponent->GetAttachParent(), ParentComponent->GetAttachChildren().Num() });
+
+	ParentComponent->GetChildrenComponents(true, GatherChildrenScratch);
+	for (USceneComponent* Component : GatherChildrenScratch)
+	{
+		if (Component != nullptr)
+		{
+			Cache.Components.Add({ Component, Component->GetAttachParent(), Component->GetAttachChildren().Num() });
+		}
+	}
+
+	GatherChildrenScratch.Reset();
+}
+
 void FExpandedLateUpdateManager::ProcessGripArrayLateUpdatePrimitives(UGripMotionControllerComponent * MotionControllerComponent, TArray<FBPActorGripInformation> & GripArray)
 {
-	for (FBPActorGripInformation actor : GripArray)
+	for (const FBPActorGripInformation& actor : GripArray)
 	{
 		// Skip actors that are colliding if turning off late updates during collision.
 		// Also skip turning off late updates for SweepWithPhysics, as it should always be locked to the hand
@@ -8009,7 +8961,8 @@ void FExpandedLateUpdateManager::ProcessGripArrayLateUpdatePrimitives(UGripMotio
 		// Don't run late updates if we have a grip script that denies it
 		if (actor.GrippedObject->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass()))
 		{
-			TArray<UVRGripScriptBase*> GripScripts;
+			TArray<UVRGripScriptBase*>& GripScripts = GatherGripScriptsScratch;
+			GripScripts.Reset();
 			if (IVRGripInterface::Execute_GetGripScripts(actor.GrippedObject, GripScripts))
 			{
 				bool bContinueOn = false;
@@ -8110,7 +9063,7 @@ bool UGripMotionControllerComponent::GetIsObjectHeld(const UObject * ObjectToChe
 	if (!ObjectToCheck)
 		return false;
 
-	return (GrippedObjects.FindByKey(ObjectToCheck) || LocallyGrippedObjects.FindByKey(ObjectToCheck));
+	return FindGripByObject(ObjectToCheck) != nullptr;
 }
 
 bool UGripMotionControllerComponent::GetIsHeld(const AActor * ActorToCheck)
@@ -8118,7 +9071,7 @@ bool UGripMotionControllerComponent::GetIsHeld(const AActor * ActorToCheck)
 	if (!ActorToCheck)
 		return false;
 
-	return (GrippedObjects.FindByKey(ActorToCheck) || LocallyGrippedObjects.FindByKey(ActorToCheck));
+	return FindGripByObject(ActorToCheck) != nullptr;
 }
 
 bool UGripMotionControllerComponent::GetIsComponentHeld(const UPrimitiveComponent * ComponentToCheck)
@@ -8126,7 +9079,7 @@ bool UGripMotionControllerComponent::GetIsComponentHeld(const UPrimitiveComponen
 	if (!ComponentToCheck)
 		return false;
 
-	return (GrippedObjects.FindByKey(ComponentToCheck) || LocallyGrippedObjects.FindByKey(ComponentToCheck));
+	return FindGripByObject(ComponentToCheck) != nullptr;
 
 	return false;
 }
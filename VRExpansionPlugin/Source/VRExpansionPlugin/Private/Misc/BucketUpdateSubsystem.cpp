@@ -2,6 +2,7 @@
 
 #include "Misc/BucketUpdateSubsystem.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(BucketUpdateSubsystem)
+#include "VRGlobalSettings.h"
 
 	bool UBucketUpdateSubsystem::AddObjectToBucket(int32 UpdateHTZ, UObject* InObject, FName FunctionName)
 	{
@@ -44,6 +45,22 @@
 		return BucketContainer.RemoveBucketObject(Delegate);
 	}
 
+	bool UBucketUpdateSubsystem::RemoveNativeObjectFromBucket(UObject* InObject, FName CallbackName)
+	{
+		if (!InObject)
+			return false;
+
+		return BucketContainer.RemoveNativeBucketObject(InObject, CallbackName);
+	}
+
+	bool UBucketUpdateSubsystem::RemoveObjectFromBatchedBucket(UObject* InObject, FName BatchName)
+	{
+		if (!InObject)
+			return false;
+
+		return BucketContainer.RemoveBatchedBucketObject(InObject, BatchName);
+	}
+
 	bool UBucketUpdateSubsystem::RemoveObjectFromAllBuckets(UObject* InObject)
 	{
 		if (!InObject)
@@ -138,12 +155,14 @@
 		FunctionName = NAME_None;
 	}
 
-	FUpdateBucketDrop::FUpdateBucketDrop(FDynamicBucketUpdateTickSignature & DynCallback)
+	FUpdateBucketDrop::FUpdateBucketDrop(FDynamicBucketUpdateTickSignature & DynCallback) :
+		Key(DynCallback)
 	{
 		DynamicCallback = DynCallback;
 	}
 
-	FUpdateBucketDrop::FUpdateBucketDrop(UObject * Obj, FName FuncName)
+	FUpdateBucketDrop::FUpdateBucketDrop(UObject * Obj, FName FuncName) :
+		Key(Obj, FuncName)
 	{
 		if (Obj && Obj->FindFunction(FuncName))
 		{
@@ -155,40 +174,264 @@
 			FunctionName = NAME_None;
 		}
 	}
+
+	void FUpdateBucketBatch::AddObject(UObject* InObject)
+	{
+		TObjectKey<UObject> ObjectKey(InObject);
+		if (!ObjectSlots.Contains(ObjectKey))
+		{
+			ObjectSlots.Add(ObjectKey, Objects.Add(ObjectKey));
+		}
+	}
+
+	bool FUpdateBucketBatch::RemoveObject(const TObjectKey<UObject>& InObject)
+	{
+		if (int32* Slot = ObjectSlots.Find(InObject))
+		{
+			RemoveObjectAt(*Slot);
+			return true;
+		}
+
+		return false;
+	}
+
+	void FUpdateBucketBatch::RemoveObjectAt(int32 Index)
+	{
+		ObjectSlots.Remove(Objects[Index]);
+		Objects.RemoveAtSwap(Index, 1, false);
+
+		// The last object was moved into this slot
+		if (Objects.IsValidIndex(Index))
+		{
+			ObjectSlots.Add(Objects[Index], Index);
+		}
+	}
+
+	void FUpdateBucketBatch::Update(float DeltaTime, float UpdateRate, bool bSpreadOverPeriod, FName BatchName, TArray<FUpdateBucketKey>& OutRemovedCallbacks)
+	{
+		int32 NumToDispatch = 0;
+
+		if (bSpreadOverPeriod)
+		{
+			CallbackCredit += (DeltaTime / UpdateRate) * Objects.Num();
+			CallbackCredit = FMath::Min(CallbackCredit, (float)Objects.Num());
+			NumToDispatch = FMath::FloorToInt(CallbackCredit);
+		}
+		else
+		{
+			// Bucket already checked that the period is up
+			NextObjectIndex = 0;
+			NumToDispatch = Objects.Num();
+		}
+
+		// Resolve the run of objects up front so that the batch function gets them in one contiguous array
+		TArray<UObject*, TInlineAllocator<64>> DispatchObjects;
+		int32 NumVisited = 0;
+		while (NumVisited < NumToDispatch && Objects.Num() > 0)
+		{
+			if (NextObjectIndex >= Objects.Num())
+				NextObjectIndex = 0;
+
+			++NumVisited;
+
+			if (UObject* Object = Objects[NextObjectIndex].ResolveObjectPtr())
+			{
+				DispatchObjects.Add(Object);
+				++NextObjectIndex;
+			}
+			else
+			{
+				// Object is gone, drop it
+				OutRemovedCallbacks.Add(FUpdateBucketKey(Objects[NextObjectIndex], BatchName, EUpdateBucketCallbackType::Batch));
+				RemoveObjectAt(NextObjectIndex);
+			}
+		}
+
+		if (bSpreadOverPeriod)
+		{
+			CallbackCredit = FMath::Max(CallbackCredit - NumVisited, 0.0f);
+		}
+
+		if (DispatchObjects.Num() > 0 && BatchFunction)
+		{
+			BatchFunction(DispatchObjects);
+		}
+	}
+
+	void FUpdateBucket::AddCallback(const FUpdateBucketDrop& NewCallback)
+	{
+		CallbackSlots.Add(NewCallback.Key, Callbacks.Add(NewCallback));
+	}
+
+	void FUpdateBucket::AddBatchObject(FName BatchName, UObject* InObject, const UClass* ObjectClass, const FBucketUpdateBatchFunction& BatchFunction)
+	{
+		TSharedPtr<FUpdateBucketBatch>& Batch = Batches.FindOrAdd(BatchName);
+		if (!Batch.IsValid())
+		{
+			Batch = MakeShared<FUpdateBucketBatch>();
+		}
+
+		// Keep the existing function, an emptied batch that hasn't been cleaned up yet can be taken over
+		if (!Batch->BatchFunction || Batch->Objects.Num() < 1)
+		{
+			Batch->BatchFunction = BatchFunction;
+			Batch->ObjectClass = ObjectClass;
+		}
+
+		Batch->AddObject(InObject);
+	}
+
+	bool FUpdateBucket::CanAddBatchObject(FName BatchName, const UClass* ObjectClass) const
+	{
+		const TSharedPtr<FUpdateBucketBatch>* Batch = Batches.Find(BatchName);
+		return !Batch || (*Batch)->Objects.Num() < 1 || (*Batch)->ObjectClass == ObjectClass;
+	}
+
+	bool FUpdateBucket::RemoveCallback(const FUpdateBucketKey& Key)
+	{
+		if (Key.Type == EUpdateBucketCallbackType::Batch)
+		{
+			// Empty batches get cleaned up on the next update
+			TSharedPtr<FUpdateBucketBatch>* Batch = Batches.Find(Key.FunctionName);
+			return Batch && (*Batch)->RemoveObject(Key.Object);
+		}
+
+		if (int32* Slot = CallbackSlots.Find(Key))
+		{
+			RemoveCallbackAt(*Slot);
+			return true;
+		}
+
+		return false;
+	}
+
+	void FUpdateBucket::RemoveCallbackAt(int32 Index)
+	{
+		CallbackSlots.Remove(Callbacks[Index].Key);
+		Callbacks.RemoveAtSwap(Index, 1, false);
+
+		// The last callback was moved into this slot
+		if (Callbacks.IsValidIndex(Index))
+		{
+			CallbackSlots.Add(Callbacks[Index].Key, Index);
+		}
+	}
 	
-	bool FUpdateBucket::Update(float DeltaTime)
+	bool FUpdateBucket::Update(float DeltaTime, bool bSpreadOverPeriod, double BudgetEndTime, TArray<FUpdateBucketKey>& OutRemovedCallbacks)
 	{
-		//#TODO: Need to consider batching / spreading out load if there are a lot of updating objects in the bucket
-		if (Callbacks.Num() < 1)
+		if (Callbacks.Num() < 1 && Batches.Num() < 1)
 			return false;
 
-		// Check for if this bucket is ready to fire events
-		nUpdateCount += DeltaTime;
-		if (nUpdateCount >= nUpdateRate)
+		int32 NumToFire = 0;
+
+		if (bSpreadOverPeriod)
+		{
+			// Every callback fires once per period, so owe a matching slice of them each frame
+			CallbackCredit += (DeltaTime / nUpdateRate) * Callbacks.Num();
+
+			// Don't back up more than a full period, firing the same callback twice in a frame is pointless
+			CallbackCredit = FMath::Min(CallbackCredit, (float)Callbacks.Num());
+			NumToFire = FMath::FloorToInt(CallbackCredit);
+		}
+		else
+		{
+			// Check for if this bucket is ready to fire events
+			nUpdateCount += DeltaTime;
+			if (nUpdateCount < nUpdateRate)
+				return true;
+
+			// Keep the remainder so the rate doesn't drift low, but drop whole missed periods rather than bursting
+			nUpdateCount = FMath::Fmod(nUpdateCount, nUpdateRate);
+			NextCallbackIndex = 0;
+			NumToFire = Callbacks.Num();
+
+			// The budget only applies to spread updates, otherwise the tail of the bucket would never get called
+			BudgetEndTime = 0.0;
+		}
+
+		int32 NumFired = 0;
+		while (NumFired < NumToFire && Callbacks.Num() > 0)
+		{
+			// Always let at least one through so that a bucket can't be starved by the ones ahead of it
+			if (NumFired > 0 && BudgetEndTime > 0.0 && FPlatformTime::Seconds() >= BudgetEndTime)
+				break;
+
+			if (NextCallbackIndex >= Callbacks.Num())
+				NextCallbackIndex = 0;
+
+			++NumFired;
+
+			const FUpdateBucketKey CallbackKey = Callbacks[NextCallbackIndex].Key;
+			if (Callbacks[NextCallbackIndex].ExecuteBoundCallback())
+			{
+				// If this returns true then we keep it in the queue
+				++NextCallbackIndex;
+				continue;
+			}
+
+			// Remove the callback, it is complete or invalid
+			// Goes by key as the callback could have modified the bucket itself, the swapped in callback takes this slot next
+			if (RemoveCallback(CallbackKey))
+			{
+				OutRemovedCallbacks.Add(CallbackKey);
+			}
+		}
+
+		if (bSpreadOverPeriod)
+		{
+			CallbackCredit = FMath::Max(CallbackCredit - NumFired, 0.0f);
+		}
+
+		if (Batches.Num() > 0)
 		{
-			nUpdateCount = 0.0f;
-			for (int i = Callbacks.Num() - 1; i >= 0; --i)
+			// Batch functions can add or remove batches, so run off of a copy
+			TArray<TPair<FName, TSharedPtr<FUpdateBucketBatch>>, TInlineAllocator<8>> CurrentBatches;
+			for (const TPair<FName, TSharedPtr<FUpdateBucketBatch>>& Batch : Batches)
 			{
-				if (Callbacks[i].ExecuteBoundCallback())
+				CurrentBatches.Add(Batch);
+			}
+
+			for (const TPair<FName, TSharedPtr<FUpdateBucketBatch>>& Batch : CurrentBatches)
+			{
+				Batch.Value->Update(DeltaTime, nUpdateRate, bSpreadOverPeriod, Batch.Key, OutRemovedCallbacks);
+			}
+
+			for (auto It = Batches.CreateIterator(); It; ++It)
+			{
+				if (It.Value()->Objects.Num() < 1)
 				{
-					// If this returns true then we keep it in the queue
-					continue;
+					It.RemoveCurrent();
 				}
-
-				// Remove the callback, it is complete or invalid
-				Callbacks.RemoveAt(i);
 			}
 		}
 
-		return Callbacks.Num() > 0;
+		return Callbacks.Num() > 0 || Batches.Num() > 0;
 	}
 	
 	void FUpdateBucketContainer::UpdateBuckets(float DeltaTime)
 	{
+		const UVRGlobalSettings& VRSettings = *GetDefault<UVRGlobalSettings>();
+		const double BudgetEndTime = VRSettings.BucketUpdateBudgetMS > 0.f ? FPlatformTime::Seconds() + (VRSettings.BucketUpdateBudgetMS / 1000.0) : 0.0;
+
 		TArray<uint32> BucketsToRemove;
+		TArray<FUpdateBucketKey> RemovedCallbacks;
 		for(auto& Bucket : ReplicationBuckets)
 		{		
-			if (!Bucket.Value.Update(DeltaTime))
+			RemovedCallbacks.Reset();
+			const bool bBucketStillActive = Bucket.Value.Update(DeltaTime, VRSettings.bSpreadBucketUpdatesOverPeriod, BudgetEndTime, RemovedCallbacks);
+
+			// Keep the index in sync with what the bucket dropped
+			for (const FUpdateBucketKey& RemovedKey : RemovedCallbacks)
+			{
+				uint32* CallbackBucket = CallbackBuckets.Find(RemovedKey);
+				if (CallbackBucket && *CallbackBucket == Bucket.Key)
+				{
+					CallbackBuckets.Remove(RemovedKey);
+					ObjectCallbacks.RemoveSingle(RemovedKey.Object, RemovedKey);
+				}
+			}
+
+			if (!bBucketStillActive)
 			{
 				// Add Bucket to list to remove at end of update
 				BucketsToRemove.Add(Bucket.Key);
@@ -210,22 +453,7 @@
 		if (!InObject || InObject->FindFunction(FunctionName) == nullptr || UpdateHTZ < 1)
 			return false;
 
-		// First verify that this object isn't already contained in a bucket, if it is then erase it so that we can replace it below
-		RemoveBucketObject(InObject, FunctionName);
-
-		if (ReplicationBuckets.Contains(UpdateHTZ))
-		{
-			ReplicationBuckets[UpdateHTZ].Callbacks.Add(FUpdateBucketDrop(InObject, FunctionName));
-		}
-		else
-		{
-			FUpdateBucket & newBucket = ReplicationBuckets.Add(UpdateHTZ, FUpdateBucket(UpdateHTZ));
-			ReplicationBuckets[UpdateHTZ].Callbacks.Add(FUpdateBucketDrop(InObject, FunctionName));
-		}
-
-		if (ReplicationBuckets.Num() > 0)
-			bNeedsUpdate = true;
-
+		AddBucketDrop(UpdateHTZ, FUpdateBucketDrop(InObject, FunctionName));
 		return true;
 	}
 
@@ -235,87 +463,106 @@
 		if (!Delegate.IsBound() || UpdateHTZ < 1)
 			return false;
 
-		// First verify that this object isn't already contained in a bucket, if it is then erase it so that we can replace it below
-		RemoveBucketObject(Delegate);
+		AddBucketDrop(UpdateHTZ, FUpdateBucketDrop(Delegate));
+		return true;
+	}
 
-		if (ReplicationBuckets.Contains(UpdateHTZ))
+	bool FUpdateBucketContainer::AddUntypedBatchedBucketObject(uint32 UpdateHTZ, UObject* InObject, FName BatchName, const UClass* ObjectClass, const FBucketUpdateBatchFunction& BatchFunction)
+	{
+		if (!InObject || BatchName.IsNone() || !ObjectClass || !BatchFunction || UpdateHTZ < 1)
+			return false;
+
+		if (!ensureMsgf(InObject->IsA(ObjectClass), TEXT("Object %s is not a %s, can't be added to bucket batch %s"), *InObject->GetName(), *ObjectClass->GetName(), *BatchName.ToString()))
+			return false;
+
+		// The batch function casts every object in the batch, so a batch name can't be shared between classes
+		const FUpdateBucket* ExistingBucket = ReplicationBuckets.Find(UpdateHTZ);
+		if (ExistingBucket && !ensureMsgf(ExistingBucket->CanAddBatchObject(BatchName, ObjectClass), TEXT("Bucket batch %s is already registered for a different class than %s"), *BatchName.ToString(), *ObjectClass->GetName()))
+			return false;
+
+		const FUpdateBucketKey NewKey(InObject, BatchName, EUpdateBucketCallbackType::Batch);
+
+		// Objects can only be in one bucket per batch name, same as the other callbacks
+		RemoveBucketKey(NewKey);
+
+		FUpdateBucket* Bucket = ReplicationBuckets.Find(UpdateHTZ);
+		if (!Bucket)
 		{
-			ReplicationBuckets[UpdateHTZ].Callbacks.Add(FUpdateBucketDrop(Delegate));
+			Bucket = &ReplicationBuckets.Add(UpdateHTZ, FUpdateBucket(UpdateHTZ));
 		}
-		else
+
+		Bucket->AddBatchObject(BatchName, InObject, ObjectClass, BatchFunction);
+		CallbackBuckets.Add(NewKey, UpdateHTZ);
+		ObjectCallbacks.Add(NewKey.Object, NewKey);
+
+		bNeedsUpdate = true;
+		return true;
+	}
+
+	void FUpdateBucketContainer::AddBucketDrop(uint32 UpdateHTZ, const FUpdateBucketDrop& NewDrop)
+	{
+		// First verify that this callback isn't already contained in a bucket, if it is then erase it so that we can replace it below
+		RemoveBucketKey(NewDrop.Key);
+
+		FUpdateBucket* Bucket = ReplicationBuckets.Find(UpdateHTZ);
+		if (!Bucket)
 		{
-			FUpdateBucket & newBucket = ReplicationBuckets.Add(UpdateHTZ, FUpdateBucket(UpdateHTZ));
-			ReplicationBuckets[UpdateHTZ].Callbacks.Add(FUpdateBucketDrop(Delegate));
+			Bucket = &ReplicationBuckets.Add(UpdateHTZ, FUpdateBucket(UpdateHTZ));
 		}
 
-		if (ReplicationBuckets.Num() > 0)
-			bNeedsUpdate = true;
+		Bucket->AddCallback(NewDrop);
+		CallbackBuckets.Add(NewDrop.Key, UpdateHTZ);
+		ObjectCallbacks.Add(NewDrop.Key.Object, NewDrop.Key);
 
-		return true;
+		bNeedsUpdate = true;
 	}
 
-	bool FUpdateBucketContainer::RemoveBucketObject(UObject * ObjectToRemove, FName FunctionName)
+	bool FUpdateBucketContainer::RemoveBucketKey(const FUpdateBucketKey& Key)
 	{
-		if (!ObjectToRemove || ObjectToRemove->FindFunction(FunctionName) == nullptr)
+		uint32 UpdateHTZ = 0;
+		if (!CallbackBuckets.RemoveAndCopyValue(Key, UpdateHTZ))
 			return false;
 
-		// Store if we ended up removing it
-		bool bRemovedObject = false;
+		ObjectCallbacks.RemoveSingle(Key.Object, Key);
 
-		TArray<uint32> BucketsToRemove;
-		for (auto& Bucket : ReplicationBuckets)
+		if (FUpdateBucket* Bucket = ReplicationBuckets.Find(UpdateHTZ))
 		{
-			for (int i = Bucket.Value.Callbacks.Num() - 1; i >= 0; --i)
-			{
-				if (Bucket.Value.Callbacks[i].IsBoundToObjectFunction(ObjectToRemove, FunctionName))
-				{
-					Bucket.Value.Callbacks.RemoveAt(i);
-					bRemovedObject = true;
+			Bucket->RemoveCallback(Key);
+		}
 
-					// Leave the loop, this is called in add as well so we should never get duplicate entries
-					break;
-				}
-			}
+		return true;
+	}
 
-			if (bRemovedObject)
-			{
-				break;
-			}
-		}
+	bool FUpdateBucketContainer::RemoveBucketObject(UObject * ObjectToRemove, FName FunctionName)
+	{
+		if (!ObjectToRemove)
+			return false;
 
-		return bRemovedObject;
+		return RemoveBucketKey(FUpdateBucketKey(ObjectToRemove, FunctionName));
 	}
 
-	bool FUpdateBucketContainer::RemoveBucketObject(FDynamicBucketUpdateTickSignature &DynEvent)
+	bool FUpdateBucketContainer::RemoveNativeBucketObject(UObject* ObjectToRemove, FName CallbackName)
 	{
-		if (!DynEvent.IsBound())
+		if (!ObjectToRemove)
 			return false;
 
-		// Store if we ended up removing it
-		bool bRemovedObject = false;
+		return RemoveBucketKey(FUpdateBucketKey(ObjectToRemove, CallbackName, EUpdateBucketCallbackType::Native));
+	}
 
-		TArray<uint32> BucketsToRemove;
-		for (auto& Bucket : ReplicationBuckets)
-		{
-			for (int i = Bucket.Value.Callbacks.Num() - 1; i >= 0; --i)
-			{
-				if (Bucket.Value.Callbacks[i].IsBoundToObjectDelegate(DynEvent))
-				{
-					Bucket.Value.Callbacks.RemoveAt(i);
-					bRemovedObject = true;
+	bool FUpdateBucketContainer::RemoveBatchedBucketObject(UObject* ObjectToRemove, FName BatchName)
+	{
+		if (!ObjectToRemove)
+			return false;
 
-					// Leave the loop, this is called in add as well so we should never get duplicate entries
-					break;
-				}
-			}
+		return RemoveBucketKey(FUpdateBucketKey(ObjectToRemove, BatchName, EUpdateBucketCallbackType::Batch));
+	}
 
-			if (bRemovedObject)
-			{
-				break;
-			}
-		}
+	bool FUpdateBucketContainer::RemoveBucketObject(FDynamicBucketUpdateTickSignature &DynEvent)
+	{
+		if (!DynEvent.IsBound())
+			return false;
 
-		return bRemovedObject;
+		return RemoveBucketKey(FUpdateBucketKey(DynEvent));
 	}
 
 	bool FUpdateBucketContainer::RemoveObjectFromAllBuckets(UObject * ObjectToRemove)
@@ -323,59 +570,31 @@
 		if (!ObjectToRemove)
 			return false;
 
-		// Store if we ended up removing it
-		bool bRemovedObject = false;
+		TArray<FUpdateBucketKey> KeysToRemove;
+		ObjectCallbacks.MultiFind(ObjectToRemove, KeysToRemove);
 
-		TArray<uint32> BucketsToRemove;
-		for (auto& Bucket : ReplicationBuckets)
+		for (const FUpdateBucketKey& Key : KeysToRemove)
 		{
-			for (int i = Bucket.Value.Callbacks.Num() - 1; i >= 0; --i)
-			{
-				if (Bucket.Value.Callbacks[i].IsBoundToObject(ObjectToRemove))
-				{
-					Bucket.Value.Callbacks.RemoveAt(i);
-					bRemovedObject = true;
-				}
-			}
+			RemoveBucketKey(Key);
 		}
 
-		return bRemovedObject;
+		return KeysToRemove.Num() > 0;
 	}
 
 	bool FUpdateBucketContainer::IsObjectInBucket(UObject * ObjectToRemove)
 	{
 		if (!ObjectToRemove)
 			return false;
-		for (auto& Bucket : ReplicationBuckets)
-		{
-			for (int i = Bucket.Value.Callbacks.Num() - 1; i >= 0; --i)
-			{
-				if (Bucket.Value.Callbacks[i].IsBoundToObject(ObjectToRemove))
-				{
-					return true;
-				}
-			}
-		}
 
-		return false;
+		return ObjectCallbacks.Contains(ObjectToRemove);
 	}
 
 	bool FUpdateBucketContainer::IsObjectFunctionInBucket(UObject * ObjectToRemove, FName FunctionName)
 	{
 		if (!ObjectToRemove)
 			return false;
-		for (auto& Bucket : ReplicationBuckets)
-		{
-			for (int i = Bucket.Value.Callbacks.Num() - 1; i >= 0; --i)
-			{
-				if (Bucket.Value.Callbacks[i].IsBoundToObjectFunction(ObjectToRemove, FunctionName))
-				{
-					return true;
-				}
-			}
-		}
 
-		return false;
+		return CallbackBuckets.Contains(FUpdateBucketKey(ObjectToRemove, FunctionName));
 	}
 
 	bool FUpdateBucketContainer::IsObjectDelegateInBucket(FDynamicBucketUpdateTickSignature &DynEvent)
@@ -383,16 +602,5 @@
 		if (!DynEvent.IsBound())
 			return false;
 
-		for (auto& Bucket : ReplicationBuckets)
-		{
-			for (int i = Bucket.Value.Callbacks.Num() - 1; i >= 0; --i)
-			{
-				if (Bucket.Value.Callbacks[i].IsBoundToObjectDelegate(DynEvent))
-				{
-					return true;
-				}
-			}
-		}
-
-		return false;
-	}
\ No newline at end of file
+		return CallbackBuckets.Contains(FUpdateBucketKey(DynEvent));
+	}
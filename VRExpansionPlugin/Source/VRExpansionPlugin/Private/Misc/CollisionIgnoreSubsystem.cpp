@@ -19,17 +19,34 @@
 
 DEFINE_LOG_CATEGORY(VRE_CollisionIgnoreLog);
 
+DECLARE_CYCLE_STAT(TEXT("CollisionIgnore ~ ContactModification"), STAT_CollisionIgnoreContactModification, STATGROUP_CollisionIgnore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("CollisionIgnore ~ Ignored Particle Pairs"), STAT_CollisionIgnoreParticlePairs, STATGROUP_CollisionIgnore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("CollisionIgnore ~ Contacts Inspected"), STAT_CollisionIgnoreContactsInspected, STATGROUP_CollisionIgnore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("CollisionIgnore ~ Contacts Disabled"), STAT_CollisionIgnoreContactsDisabled, STATGROUP_CollisionIgnore);
+
 
 void FCollisionIgnoreSubsystemAsyncCallback::OnContactModification_Internal(Chaos::FCollisionContactModifier& Modifier)
 {
+	SCOPE_CYCLE_COUNTER(STAT_CollisionIgnoreContactModification);
+
 	const FSimCallbackInputVR* Input = GetConsumerInput_Internal();
 
 	if (Input && Input->bIsInitialized)
 	{
+		ApplyPairDeltas_Internal(Input);
+	}
+
+	if (ParticlePairs_Internal.Num() > 0)
+	{
+		uint32 ContactsInspected = 0;
+		uint32 ContactsDisabled = 0;
+
 		for (Chaos::FContactPairModifierIterator ContactIterator = Modifier.Begin(); ContactIterator; ++ContactIterator)
 		{
 			if (ContactIterator.IsValid())
 			{
+				++ContactsInspected;
+
 				Chaos::TVec2<Chaos::FGeometryParticleHandle*> Pair = ContactIterator->GetParticlePair();
 
 				Chaos::TPBDRigidParticleHandle<Chaos::FReal, 3>* ParticleHandle0 = Pair[0]->CastToRigidParticle();
@@ -55,40 +72,83 @@ void FCollisionIgnoreSubsystemAsyncCallback::OnContactModification_Internal(Chao
 					{
 						FChaosParticlePair SearchPair(ParticleHandle0, ParticleHandle1);
 
-						if (Input->ParticlePairs.Contains(SearchPair))
+						if (ParticlePairs_Internal.Contains(SearchPair))
 						{
 							ContactIterator->Disable();
+							++ContactsDisabled;
 						}
 					}
 				}
 			}
 		}
+
+		// Contact counters accumulate over every physics step in the frame
+		SET_DWORD_STAT(STAT_CollisionIgnoreParticlePairs, ParticlePairs_Internal.Num());
+		INC_DWORD_STAT_BY(STAT_CollisionIgnoreContactsInspected, ContactsInspected);
+		INC_DWORD_STAT_BY(STAT_CollisionIgnoreContactsDisabled, ContactsDisabled);
 	}
 }
 
+void FCollisionIgnoreSubsystemAsyncCallback::ApplyPairDeltas_Internal(const FSimCallbackInputVR* Input)
+{
+	int32 LastApplied = LastAppliedSerial.load(std::memory_order_relaxed);
+
+	for (const FChaosParticlePairDelta& Delta : Input->PairDeltas)
+	{
+		// Already applied from an earlier input, or from this one on an earlier sub step
+		if (Delta.Serial <= LastApplied)
+			continue;
+
+		if (Delta.bAdded)
+		{
+			ParticlePairs_Internal.FindOrAdd(Delta.Pair, 0)++;
+		}
+		else if (int32* PairCount = ParticlePairs_Internal.Find(Delta.Pair))
+		{
+			if (--(*PairCount) <= 0)
+			{
+				ParticlePairs_Internal.Remove(Delta.Pair);
+			}
+		}
+
+		LastApplied = Delta.Serial;
+	}
+
+	LastAppliedSerial.store(LastApplied, std::memory_order_release);
+}
+
+void UCollisionIgnoreSubsystem::QueuePairDelta(const FCollisionIgnorePair& IgnorePair, bool bAdded)
+{
+	// The callback gets seeded with everything tracked when it is created, so nothing to do until then
+	if (!ContactModifierCallback || !IgnorePair.ParticlePair.ParticleHandle0 || !IgnorePair.ParticlePair.ParticleHandle1)
+		return;
+
+	PendingPairDeltas.Add(FChaosParticlePairDelta(IgnorePair.ParticlePair, ++PairDeltaSerial, bAdded));
+}
+
 void UCollisionIgnoreSubsystem::ConstructInput()
 {
 	if (ContactModifierCallback)
 	{
+		// Drop everything the physics thread has already applied
+		const int32 AcknowledgedSerial = ContactModifierCallback->LastAppliedSerial.load(std::memory_order_acquire);
+		PendingPairDeltas.RemoveAll([AcknowledgedSerial](const FChaosParticlePairDelta& Delta)
+		{
+			return Delta.Serial <= AcknowledgedSerial;
+		});
+
+		if (PendingPairDeltas.Num() < 1)
+			return;
+
 		FSimCallbackInputVR* Input = ContactModifierCallback->GetProducerInputData_External();
 		if (Input->bIsInitialized == false)
 		{
 			Input->bIsInitialized = true;
 		}
 
-		// Clear out the pair array
+		// Clear out the delta array
 		Input->Reset();
-
-		for (TPair<FCollisionPrimPair, FCollisionIgnorePairArray>& CollisionPairArray : CollisionTrackedPairs)
-		{
-			for (FCollisionIgnorePair& IgnorePair : CollisionPairArray.Value.PairArray)
-			{
-				if (IgnorePair.Actor1 && IgnorePair.Actor2)
-				{
-					Input->ParticlePairs.Add(FChaosParticlePair(IgnorePair.Actor1->GetHandle_LowLevel()->CastToRigidParticle(), IgnorePair.Actor2->GetHandle_LowLevel()->CastToRigidParticle()));
-				}
-			}
-		}
+		Input->PairDeltas.Append(PendingPairDeltas);
 	}
 }
 
@@ -100,33 +160,50 @@ void UCollisionIgnoreSubsystem::UpdateTimer(bool bChangesWereMade)
 
 	if (CollisionTrackedPairs.Num() > 0)
 	{
-		if (!UpdateHandle.IsValid())
+		if (VRSettings.bUseEventDrivenCollisionIgnoreChecks)
+		{
+			// No heartbeat, just wake up for the next pair that is due
+			ScheduleNextPairCheck();
+		}
+		else if (!UpdateHandle.IsValid())
 		{
 			// Setup the heartbeat on 1htz checks
 			GetWorld()->GetTimerManager().SetTimer(UpdateHandle, this, &UCollisionIgnoreSubsystem::CheckActiveFilters, VRSettings.CollisionIgnoreSubsystemUpdateRate, true, VRSettings.CollisionIgnoreSubsystemUpdateRate);
+		}
 
-			if (VRSettings.bUseCollisionModificationForCollisionIgnore && !ContactModifierCallback)
+		if (VRSettings.bUseCollisionModificationForCollisionIgnore && !ContactModifierCallback)
+		{
+			if (UWorld* World = GetWorld())
 			{
-				if (UWorld* World = GetWorld())
+				if (FPhysScene* PhysScene = World->GetPhysicsScene())
 				{
-					if (FPhysScene* PhysScene = World->GetPhysicsScene())
+					// Register a callback
+					ContactModifierCallback = PhysScene->GetSolver()->CreateAndRegisterSimCallbackObject_External<FCollisionIgnoreSubsystemAsyncCallback>(/*true*/);
+
+					// Fresh callback, seed it with everything we are already tracking
+					PendingPairDeltas.Reset();
+					PairDeltaSerial = 0;
+					for (const TPair<FCollisionPrimPair, FCollisionIgnorePairArray>& CollisionPairArray : CollisionTrackedPairs)
 					{
-						// Register a callback
-						ContactModifierCallback = PhysScene->GetSolver()->CreateAndRegisterSimCallbackObject_External<FCollisionIgnoreSubsystemAsyncCallback>(/*true*/);
+						for (const FCollisionIgnorePair& IgnorePair : CollisionPairArray.Value.PairArray)
+						{
+							QueuePairDelta(IgnorePair, true);
+						}
 					}
 				}
 			}
 		}
 
-		// Need to only add input when changes are made
-		if (VRSettings.bUseCollisionModificationForCollisionIgnore && ContactModifierCallback && bChangesWereMade)
+		// Only sends input when there are changes the physics thread hasn't applied yet
+		if (VRSettings.bUseCollisionModificationForCollisionIgnore && ContactModifierCallback)
 		{
 			ConstructInput();
 		}
 	}
-	else if (UpdateHandle.IsValid())
+	else if (UpdateHandle.IsValid() || ContactModifierCallback)
 	{
 		GetWorld()->GetTimerManager().ClearTimer(UpdateHandle);
+		PairCheckQueue.Reset();
 
 		if (VRSettings.bUseCollisionModificationForCollisionIgnore && ContactModifierCallback)
 		{
@@ -140,6 +217,7 @@ void UCollisionIgnoreSubsystem::UpdateTimer(bool bChangesWereMade)
 					// UnRegister a callback
 					PhysScene->GetSolver()->UnregisterAndFreeSimCallbackObject_External(ContactModifierCallback);
 					ContactModifierCallback = nullptr;
+					PendingPairDeltas.Reset();
 				}
 			}
 		}
@@ -284,18 +362,151 @@ void UCollisionIgnoreSubsystem::CheckActiveFilters()
 	}
 #endif*/
 
+	RemoveFlaggedPairs();
+	UpdateTimer(bMadeChanges);
+}
+
+void UCollisionIgnoreSubsystem::RemoveFlaggedPairs()
+{
 	for (const TPair<FCollisionPrimPair, FCollisionIgnorePairArray>& KeyPair : RemovedPairs)
 	{
-		if (CollisionTrackedPairs.Contains(KeyPair.Key))
+		if (FCollisionIgnorePairArray* TrackedPairs = CollisionTrackedPairs.Find(KeyPair.Key))
+		{
+			for (const FCollisionIgnorePair& IgnorePair : TrackedPairs->PairArray)
+			{
+				QueuePairDelta(IgnorePair, false);
+			}
+
+			TrackedPairs->PairArray.Empty();
+			UntrackPrimPair(KeyPair.Key);
+		}
+	}
+}
+
+void UCollisionIgnoreSubsystem::ProcessPairChecks()
+{
+	const double CurrentTime = GetWorld()->GetTimeSeconds();
+	bool bMadeChanges = false;
+
+	// Only pop what is due, the rest of the pairs aren't touched at all
+	while (PairCheckQueue.Num() > 0 && PairCheckQueue.HeapTop().CheckTime <= CurrentTime)
+	{
+		FCollisionIgnorePairCheck PairCheck;
+		PairCheckQueue.HeapPop(PairCheck, false);
+
+		if (!IsPairCheckCurrent(PairCheck))
+			continue;
+
+		FCollisionIgnorePairArray& TrackedPairs = CollisionTrackedPairs[PairCheck.PrimPair];
+
+		// Same checks as CheckActiveFilters, invalid primitives or no pairs left
+		if (!IsValid(PairCheck.PrimPair.Prim1) || !IsValid(PairCheck.PrimPair.Prim2) || TrackedPairs.PairArray.Num() < 1)
 		{
-			CollisionTrackedPairs[KeyPair.Key].PairArray.Empty();
-			CollisionTrackedPairs.Remove(KeyPair.Key);
+			if (!RemovedPairs.Contains(PairCheck.PrimPair))
+			{
+				RemovedPairs.Add(PairCheck.PrimPair, TrackedPairs);
+				bMadeChanges = true;
+			}
 		}
+
+		// Pairs that are still fine aren't re-queued, the next change to them queues its own check
 	}
 
+	RemoveFlaggedPairs();
 	UpdateTimer(bMadeChanges);
 }
 
+void UCollisionIgnoreSubsystem::SchedulePairCheck(const FCollisionPrimPair& PrimPair, FCollisionIgnorePairArray& TrackedPairs, double CheckTime)
+{
+	// Any older entry for this pair goes stale, it gets skipped when it reaches the top
+	TrackedPairs.NextCheckTime = CheckTime;
+	PairCheckQueue.HeapPush(FCollisionIgnorePairCheck(CheckTime, PrimPair));
+}
+
+bool UCollisionIgnoreSubsystem::IsPairCheckCurrent(const FCollisionIgnorePairCheck& PairCheck) const
+{
+	const FCollisionIgnorePairArray* TrackedPairs = CollisionTrackedPairs.Find(PairCheck.PrimPair);
+	return TrackedPairs && TrackedPairs->NextCheckTime == PairCheck.CheckTime;
+}
+
+void UCollisionIgnoreSubsystem::ScheduleNextPairCheck()
+{
+	// Clear stale entries off of the top so we don't wake up for nothing
+	while (PairCheckQueue.Num() > 0 && !IsPairCheckCurrent(PairCheckQueue.HeapTop()))
+	{
+		PairCheckQueue.HeapPopDiscard(false);
+	}
+
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+
+	if (PairCheckQueue.Num() < 1)
+	{
+		TimerManager.ClearTimer(UpdateHandle);
+		return;
+	}
+
+	// A zero rate would clear the timer, so clamp it and let it run on the next tick instead
+	const float Delay = FMath::Max((float)(PairCheckQueue.HeapTop().CheckTime - GetWorld()->GetTimeSeconds()), KINDA_SMALL_NUMBER);
+	TimerManager.SetTimer(UpdateHandle, this, &UCollisionIgnoreSubsystem::ProcessPairChecks, Delay, false);
+}
+
+void UCollisionIgnoreSubsystem::OnTrackedPrimitivePhysicsStateChanged(UPrimitiveComponent* ChangedComponent, EComponentPhysicsStateChange StateChange)
+{
+	// Losing the bodies is the only thing that invalidates a pair. The component is usually still mid teardown here
+	// so the check runs on the next tick instead of right away.
+	if (!ChangedComponent || StateChange != EComponentPhysicsStateChange::Destroyed)
+		return;
+
+	const double CurrentTime = GetWorld()->GetTimeSeconds();
+	bool bScheduledChecks = false;
+
+	for (TPair<FCollisionPrimPair, FCollisionIgnorePairArray>& KeyPair : CollisionTrackedPairs)
+	{
+		if (KeyPair.Key.Prim1 == ChangedComponent || KeyPair.Key.Prim2 == ChangedComponent)
+		{
+			SchedulePairCheck(KeyPair.Key, KeyPair.Value, CurrentTime);
+			bScheduledChecks = true;
+		}
+	}
+
+	if (bScheduledChecks)
+	{
+		ScheduleNextPairCheck();
+	}
+}
+
+void UCollisionIgnoreSubsystem::UntrackPrimPair(const FCollisionPrimPair& PrimPair)
+{
+	// Copy off the prims, the pair passed in may be the map key itself
+	UPrimitiveComponent* Prim1 = PrimPair.Prim1;
+	UPrimitiveComponent* Prim2 = PrimPair.Prim2;
+
+	CollisionTrackedPairs.Remove(PrimPair);
+
+	if (GetDefault<UVRGlobalSettings>()->bUseEventDrivenCollisionIgnoreChecks)
+	{
+		UnbindPrimitiveEvents(Prim1);
+		UnbindPrimitiveEvents(Prim2);
+	}
+}
+
+void UCollisionIgnoreSubsystem::UnbindPrimitiveEvents(UPrimitiveComponent* Prim)
+{
+	if (!Prim)
+		return;
+
+	// Still needed if another tracked pair shares this primitive
+	for (const TPair<FCollisionPrimPair, FCollisionIgnorePairArray>& KeyPair : CollisionTrackedPairs)
+	{
+		if (KeyPair.Key.Prim1 == Prim || KeyPair.Key.Prim2 == Prim)
+		{
+			return;
+		}
+	}
+
+	Prim->OnComponentPhysicsStateChanged.RemoveDynamic(this, &UCollisionIgnoreSubsystem::OnTrackedPrimitivePhysicsStateChanged);
+}
+
 void UCollisionIgnoreSubsystem::RemoveComponentCollisionIgnoreState(UPrimitiveComponent* Prim1)
 {
 
@@ -501,6 +712,13 @@ void UCollisionIgnoreSubsystem::SetComponentCollisionIgnoreState(bool bIterateCh
 	if (bIgnoreCollision && !CollisionTrackedPairs.Contains(newPrimPair))
 	{
 		CollisionTrackedPairs.Add(newPrimPair, FCollisionIgnorePairArray());
+
+		const UVRGlobalSettings& VRSettings = *GetDefault<UVRGlobalSettings>();
+		if (VRSettings.bUseEventDrivenCollisionIgnoreChecks)
+		{
+			Prim1->OnComponentPhysicsStateChanged.AddUniqueDynamic(this, &UCollisionIgnoreSubsystem::OnTrackedPrimitivePhysicsStateChanged);
+			Prim2->OnComponentPhysicsStateChanged.AddUniqueDynamic(this, &UCollisionIgnoreSubsystem::OnTrackedPrimitivePhysicsStateChanged);
+		}
 	}
 	else if (!bIgnoreCollision && !CollisionTrackedPairs.Contains(newPrimPair))
 	{
@@ -528,6 +746,11 @@ void UCollisionIgnoreSubsystem::SetComponentCollisionIgnoreState(bool bIterateCh
 					auto* pHandle1 = ApplicableBodies[i].BInstance->ActorHandle->GetHandle_LowLevel();
 					auto* pHandle2 = ApplicableBodies2[j].BInstance->ActorHandle->GetHandle_LowLevel();
 
+					if (pHandle1 && pHandle2)
+					{
+						newIgnorePair.ParticlePair = FChaosParticlePair(pHandle1->CastToRigidParticle(), pHandle2->CastToRigidParticle());
+					}
+
 					Chaos::FIgnoreCollisionManager& IgnoreCollisionManager = PhysScene->GetSolver()->GetEvolution()->GetBroadPhase().GetIgnoreCollisionManager();
 
 					FPhysicsCommand::ExecuteWrite(PhysScene, [&]()
@@ -553,7 +776,12 @@ void UCollisionIgnoreSubsystem::SetComponentCollisionIgnoreState(bool bIterateCh
 											newIgnorePair.FlipElements();
 										}
 
-										CollisionTrackedPairs[newPrimPair].PairArray.AddUnique(newIgnorePair);
+										FCollisionIgnorePairArray& TrackedPairs = CollisionTrackedPairs[newPrimPair];
+										if (!TrackedPairs.PairArray.Contains(newIgnorePair))
+										{
+											TrackedPairs.PairArray.Add(newIgnorePair);
+											QueuePairDelta(newIgnorePair, true);
+										}
 									}										
 								}
 							}
@@ -563,10 +791,17 @@ void UCollisionIgnoreSubsystem::SetComponentCollisionIgnoreState(bool bIterateCh
 								{
 									IgnoreCollisionManager.RemoveIgnoreCollisions(pHandle1, pHandle2);
 
-									CollisionTrackedPairs[newPrimPair].PairArray.Remove(newIgnorePair);
+									FCollisionIgnorePairArray& TrackedPairs = CollisionTrackedPairs[newPrimPair];
+									int32 TrackedIndex = TrackedPairs.PairArray.IndexOfByKey(newIgnorePair);
+									if (TrackedIndex != INDEX_NONE)
+									{
+										// Use the stored pair, the handles resolved when it was added are the ones the physics thread has
+										QueuePairDelta(TrackedPairs.PairArray[TrackedIndex], false);
+										TrackedPairs.PairArray.RemoveAt(TrackedIndex);
+									}
 									if (CollisionTrackedPairs[newPrimPair].PairArray.Num() < 1)
 									{
-										CollisionTrackedPairs.Remove(newPrimPair);
+										UntrackPrimPair(newPrimPair);
 									}
 
 									// If we don't have a map element for this pair, then add it now
@@ -583,6 +818,16 @@ void UCollisionIgnoreSubsystem::SetComponentCollisionIgnoreState(bool bIterateCh
 		}
 	}
 
+	// A pair that didn't end up with any bodies to ignore gets cleaned up on the next tick
+	if (GetDefault<UVRGlobalSettings>()->bUseEventDrivenCollisionIgnoreChecks)
+	{
+		FCollisionIgnorePairArray* TrackedPairs = CollisionTrackedPairs.Find(newPrimPair);
+		if (TrackedPairs && TrackedPairs->PairArray.Num() < 1)
+		{
+			SchedulePairCheck(newPrimPair, *TrackedPairs, GetWorld()->GetTimeSeconds());
+		}
+	}
+
 	// Update our timer state
 	UpdateTimer(true);
 }
\ No newline at end of file
@@ -0,0 +1,178 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/GripTickSubsystem.h"
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GripTickSubsystem)
+#include "GripMotionControllerComponent.h"
+#include "VRGlobalSettings.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("TickGrip ~ BatchedGripTick"), STAT_BatchedGripTick, STATGROUP_TickGrip);
+DECLARE_CYCLE_STAT(TEXT("TickGrip ~ SolveBatchedGripTransforms"), STAT_SolveBatchedGripTransforms, STATGROUP_TickGrip);
+
+void FGripTransformBatch::AddGrip(FBPActorGripInformation& Grip, int32 ParentIndex)
+{
+	ParentIndices.Add(ParentIndex);
+	RelativeTransforms.Add(Grip.RelativeTransform);
+	AdditionTransforms.Add(Grip.AdditionTransform);
+	Grips.Add(&Grip);
+}
+
+void UGripTickSubsystem::Deinitialize()
+{
+	Super::Deinitialize();
+
+	if (BatchTickFunction.IsTickFunctionRegistered())
+	{
+		BatchTickFunction.UnRegisterTickFunction();
+	}
+
+	BatchTickFunction.Target = nullptr;
+	Controllers.Empty();
+	TickingControllers.Empty();
+	TransformBatch.Reset();
+}
+
+bool UGripTickSubsystem::RegisterController(UGripMotionControllerComponent* Controller)
+{
+	UWorld* World = GetWorld();
+	if (!Controller || !World || !World->PersistentLevel)
+		return false;
+
+	if (!BatchTickFunction.IsTickFunctionRegistered())
+	{
+		BatchTickFunction.bCanEverTick = true;
+		BatchTickFunction.bStartWithTickEnabled = true;
+		BatchTickFunction.TickGroup = TG_PrePhysics;
+
+		// Controllers that tick while paused still need their grips ticked, we only run the ones that ticked anyway
+		BatchTickFunction.bTickEvenWhenPaused = true;
+		BatchTickFunction.Target = this;
+		BatchTickFunction.RegisterTickFunction(World->PersistentLevel);
+	}
+
+	Controllers.AddUnique(Controller);
+
+	// Run after the controller has updated its tracking
+	BatchTickFunction.AddPrerequisite(Controller, Controller->PrimaryComponentTick);
+	return true;
+}
+
+void UGripTickSubsystem::UnregisterController(UGripMotionControllerComponent* Controller)
+{
+	if (!Controller)
+		return;
+
+	Controllers.RemoveSingleSwap(Controller);
+	BatchTickFunction.RemovePrerequisite(Controller, Controller->PrimaryComponentTick);
+	Controller->bPendingBatchedGripTick = false;
+}
+
+void UGripTickSubsystem::TickBatchedGrips(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_BatchedGripTick);
+
+	TickingControllers.Reset();
+
+	for (int i = Controllers.Num() - 1; i >= 0; --i)
+	{
+		UGripMotionControllerComponent* Controller = Controllers[i].Get();
+
+		if (!Controller)
+		{
+			Controllers.RemoveAtSwap(i, 1, false);
+			continue;
+		}
+
+		// Only the controllers that actually ticked this frame get their grips ticked
+		if (Controller->bPendingBatchedGripTick)
+		{
+			TickingControllers.Add(Controller);
+		}
+	}
+
+	if (!TickingControllers.Num())
+		return;
+
+	// Gather the grips that only need the default transform
+	TransformBatch.Reset();
+	for (UGripMotionControllerComponent* Controller : TickingControllers)
+	{
+		Controller->GatherBatchedGripTransforms(TransformBatch);
+	}
+
+	const int32 NumGrips = TransformBatch.Num();
+	if (NumGrips > 0)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_SolveBatchedGripTransforms);
+
+		TransformBatch.WorldTransforms.SetNumUninitialized(NumGrips);
+
+		// Same order of operations as the default grip script so the results match the un-batched path
+		const FTransform* Parents = TransformBatch.ParentTransforms.GetData();
+		const int32* ParentIndices = TransformBatch.ParentIndices.GetData();
+		const FTransform* Relatives = TransformBatch.RelativeTransforms.GetData();
+		const FTransform* Additions = TransformBatch.AdditionTransforms.GetData();
+		FTransform* Results = TransformBatch.WorldTransforms.GetData();
+
+		auto SolveGrip = [Parents, ParentIndices, Relatives, Additions, Results](int32 Index)
+		{
+			Results[Index] = Relatives[Index] * Additions[Index] * Parents[ParentIndices[Index]];
+		};
+
+		const UVRGlobalSettings* VRSettings = GetDefault<UVRGlobalSettings>();
+		if (NumGrips >= FMath::Max(1, VRSettings->BatchedGripTickParallelThreshold))
+		{
+			ParallelFor(NumGrips, SolveGrip);
+		}
+		else
+		{
+			for (int32 i = 0; i < NumGrips; ++i)
+			{
+				SolveGrip(i);
+			}
+		}
+
+		// Scatter the results back, the grip tick picks them up instead of running the default script
+		for (int32 i = 0; i < NumGrips; ++i)
+		{
+			FBPActorGripInformation::FGripValueCache& Cache = TransformBatch.Grips[i]->ValueCache;
+			Cache.BatchedWorldTransform = Results[i];
+			Cache.bHasBatchedWorldTransform = true;
+		}
+	}
+
+	// Grip pointers are invalid once the grip logic starts running
+	TransformBatch.Grips.Reset();
+
+	for (UGripMotionControllerComponent* Controller : TickingControllers)
+	{
+		// A previous controllers grip logic could have ended this one
+		if (!IsValid(Controller) || !Controller->bPendingBatchedGripTick)
+			continue;
+
+		Controller->bPendingBatchedGripTick = false;
+		Controller->TickGrip(Controller->PendingBatchedGripDeltaTime);
+	}
+}
+
+void FGripTickSubsystemTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(FGripTickSubsystemTickFunction_ExecuteTick);
+
+	if (Target && IsValid(Target))
+	{
+		Target->TickBatchedGrips(DeltaTime);
+	}
+}
+
+FString FGripTickSubsystemTickFunction::DiagnosticMessage()
+{
+	return TEXT("GripTickSubsystemTickFunction");
+}
+
+FName FGripTickSubsystemTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return FName(TEXT("GripTickSubsystem"));
+}
@@ -0,0 +1,129 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/VRServerMoveBatchSubsystem.h"
+#include UE_INLINE_GENERATED_CPP_BY_NAME(VRServerMoveBatchSubsystem)
+#include "VRCharacterMovementComponent.h"
+#include "VRGlobalSettings.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+
+DECLARE_CYCLE_STAT(TEXT("Char ProcessBatchedServerMoves"), STAT_CharProcessBatchedServerMoves, STATGROUP_Character);
+
+void UVRServerMoveBatchSubsystem::Deinitialize()
+{
+	Super::Deinitialize();
+
+	if (BatchTickFunction.IsTickFunctionRegistered())
+	{
+		BatchTickFunction.UnRegisterTickFunction();
+	}
+
+	BatchTickFunction.Target = nullptr;
+	MovementComponents.Empty();
+	NextComponentIndex = 0;
+}
+
+bool UVRServerMoveBatchSubsystem::RegisterMovementComponent(UVRCharacterMovementComponent* MovementComponent)
+{
+	UWorld* World = GetWorld();
+	if (!MovementComponent || !World || !World->PersistentLevel)
+		return false;
+
+	if (!BatchTickFunction.IsTickFunctionRegistered())
+	{
+		BatchTickFunction.bCanEverTick = true;
+		BatchTickFunction.bStartWithTickEnabled = true;
+		BatchTickFunction.TickGroup = TG_PrePhysics;
+
+		// Moves keep arriving while paused, the engine processes them then as well
+		BatchTickFunction.bTickEvenWhenPaused = true;
+		BatchTickFunction.Target = this;
+		BatchTickFunction.RegisterTickFunction(World->PersistentLevel);
+	}
+
+	MovementComponents.AddUnique(MovementComponent);
+
+	// Characters should tick with their moves for this frame already applied
+	MovementComponent->PrimaryComponentTick.AddPrerequisite(this, BatchTickFunction);
+	return true;
+}
+
+void UVRServerMoveBatchSubsystem::UnregisterMovementComponent(UVRCharacterMovementComponent* MovementComponent)
+{
+	if (!MovementComponent)
+		return;
+
+	MovementComponents.Remove(MovementComponent);
+	MovementComponent->PrimaryComponentTick.RemovePrerequisite(this, BatchTickFunction);
+}
+
+void UVRServerMoveBatchSubsystem::ProcessQueuedServerMoves(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_CharProcessBatchedServerMoves);
+
+	for (int i = MovementComponents.Num() - 1; i >= 0; --i)
+	{
+		if (!MovementComponents[i].IsValid())
+		{
+			MovementComponents.RemoveAt(i, 1, false);
+		}
+	}
+
+	const int32 NumComponents = MovementComponents.Num();
+	if (!NumComponents)
+		return;
+
+	const UVRGlobalSettings* VRSettings = GetDefault<UVRGlobalSettings>();
+	const double TimeBudget = VRSettings->BatchedServerMoveTimeBudgetMS > 0.f ? (double)VRSettings->BatchedServerMoveTimeBudgetMS / 1000.0 : 0.0;
+	const double StartTime = FPlatformTime::Seconds();
+	bool bOverBudget = false;
+
+	const int32 StartIndex = NextComponentIndex % NumComponents;
+	for (int32 Offset = 0; Offset < NumComponents; ++Offset)
+	{
+		const int32 Index = (StartIndex + Offset) % NumComponents;
+		UVRCharacterMovementComponent* MovementComponent = MovementComponents[Index].Get();
+
+		if (!MovementComponent || !MovementComponent->HasQueuedServerMoves())
+			continue;
+
+		if (!bOverBudget && TimeBudget > 0.0 && (FPlatformTime::Seconds() - StartTime) >= TimeBudget)
+		{
+			bOverBudget = true;
+
+			// Pick up from here next frame
+			NextComponentIndex = Index;
+		}
+
+		// Deferred characters still get flushed once they have waited too long, otherwise they would just build up corrections
+		if (bOverBudget && MovementComponent->DeferQueuedServerMoves(VRSettings->BatchedServerMoveMaxDeferredFrames))
+			continue;
+
+		MovementComponent->ProcessQueuedServerMoves();
+	}
+
+	if (!bOverBudget)
+	{
+		NextComponentIndex = StartIndex + 1;
+	}
+}
+
+void FVRServerMoveBatchTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(FVRServerMoveBatchTickFunction_ExecuteTick);
+
+	if (Target && IsValid(Target))
+	{
+		Target->ProcessQueuedServerMoves(DeltaTime);
+	}
+}
+
+FString FVRServerMoveBatchTickFunction::DiagnosticMessage()
+{
+	return TEXT("VRServerMoveBatchTickFunction");
+}
+
+FName FVRServerMoveBatchTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return FName(TEXT("VRServerMoveBatchSubsystem"));
+}
@@ -46,6 +46,7 @@ UReplicatedVRCameraComponent::UReplicatedVRCameraComponent(const FObjectInitiali
 	bReppedOnce = false;
 
 	OverrideSendTransform = nullptr;
+	bCoalesceTransformSend = false;
 
 	LastRelativePosition = FTransform::Identity;
 	bSampleVelocityInWorldSpace = false;
@@ -237,6 +238,16 @@ void UReplicatedVRCameraComponent::UpdateTracking(float DeltaTime)
 	LastRelativePosition = bSampleVelocityInWorldSpace ? this->GetComponentTransform() : this->GetRelativeTransform();
 }
 
+FBPVRSnapshotBufferStats UReplicatedVRCameraComponent::GetSnapshotBufferStats() const
+{
+	return SnapshotBuffer.Stats;
+}
+
+void UReplicatedVRCameraComponent::ResetSnapshotBufferStats()
+{
+	SnapshotBuffer.ResetStats();
+}
+
 void UReplicatedVRCameraComponent::RunNetworkedSmoothing(float DeltaTime)
 {
 	FVector RetainPositionOffset(0.0f, 0.0f, ReplicatedCameraTransform.Position.Z);
@@ -258,7 +269,25 @@ void UReplicatedVRCameraComponent::RunNetworkedSmoothing(float DeltaTime)
 
 	if (bLerpingPosition)
 	{
-		if (!bUseExponentialSmoothing)
+		if (bUseSnapshotInterpolation)
+		{
+			// Plays back behind the newest snapshot every frame, stops once it settles on the newest one
+			// The buffered positions already have the roomscale offset applied
+			FVector NewPosition;
+			FQuat NewRotation;
+			const double LocalTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+
+			if (!SnapshotBuffer.Sample(LocalTime, SnapshotPlayoutDelay, MaxSnapshotExtrapolationTime, NewPosition, NewRotation))
+			{
+				bLerpingPosition = false;
+			}
+
+			if (SnapshotBuffer.Num())
+			{
+				SetRelativeLocationAndRotation(NewPosition, NewRotation);
+			}
+		}
+		else if (!bUseExponentialSmoothing)
 		{
 			NetUpdateCount += DeltaTime;
 			float LerpVal = FMath::Clamp(NetUpdateCount / (1.0f / NetUpdateRate), 0.0f, 1.0f);
@@ -381,8 +410,17 @@ void UReplicatedVRCameraComponent::TickComponent(float DeltaTime, enum ELevelTic
 
 	if (bHasAuthority)
 	{
+		// The owning character sends it, just keep it stored out for FPS debug characters
+		if (bCoalesceTransformSend)
+		{
+			if (bFPSDebugMode)
+			{
+				ReplicatedCameraTransform.Position = GetRelativeLocation();
+				ReplicatedCameraTransform.Rotation = GetRelativeRotation();
+			}
+		}
 		// Send changes
-		if (this->GetIsReplicated())
+		else if (this->GetIsReplicated())
 		{
 			FRotator RelativeRot = GetRelativeRotation();
 			FVector RelativeLoc = GetRelativeLocation();
@@ -403,6 +441,9 @@ void UReplicatedVRCameraComponent::TickComponent(float DeltaTime, enum ELevelTic
 						ReplicatedCameraTransform.Rotation = RelativeRot;
 					}
 
+					// Lets snapshot interpolation play it back on our timeline instead of when it arrived
+					ReplicatedCameraTransform.Timestamp = (bUseSnapshotInterpolation && GetWorld()) ? GetWorld()->GetTimeSeconds() : 0.0f;
+
 					if (GetNetMode() == NM_Client)
 					{
 						AVRBaseCharacter* OwningChar = Cast<AVRBaseCharacter>(GetOwner());
@@ -533,8 +574,23 @@ void UReplicatedVRCameraComponent::OnRep_ReplicatedCameraTransform()
 		CameraPosition += StoredCameraRotOffset.RotateVector(FVector(-AttachChar->VRRootReference->VRCapsuleOffset.X, -AttachChar->VRRootReference->VRCapsuleOffset.Y, 0.0f));
 
 	}
-    
-    if (bSmoothReplicatedMotion)
+
+	if (bSmoothReplicatedMotion && bUseSnapshotInterpolation)
+	{
+		// Played back on the senders timeline when it was stamped, otherwise on when it arrived
+		const double ReceiveTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+		const double SendTime = ReplicatedCameraTransform.Timestamp > 0.0f ? (double)ReplicatedCameraTransform.Timestamp : ReceiveTime;
+		SnapshotBuffer.AddSnapshot(SendTime, ReceiveTime, CameraPosition, ReplicatedCameraTransform.Rotation.Quaternion());
+
+		if (!bReppedOnce)
+		{
+			SetRelativeLocationAndRotation(CameraPosition, ReplicatedCameraTransform.Rotation);
+			bReppedOnce = true;
+		}
+
+		bLerpingPosition = true;
+	}
+    else if (bSmoothReplicatedMotion)
     {
         if (bReppedOnce)
         {
@@ -95,6 +95,200 @@ bool FTransform_NetQuantize::NetSerialize(FArchive& Ar, class UPackageMap* Map,
 	return bOutSuccess;
 }
 
+// ** Snapshot Interpolation Buffer ** //
+
+void FVRSnapshotInterpolationBuffer::Reset()
+{
+	Snapshots.Reset();
+	LastPlayoutTime = 0.0;
+	ClockOffset = 0.0;
+	bHasClockOffset = false;
+	PendingUnderrunTime = 0.0f;
+	bExtrapolating = false;
+}
+
+void FVRSnapshotInterpolationBuffer::ResetStats()
+{
+	Stats = FBPVRSnapshotBufferStats();
+	bHasBufferedSample = false;
+}
+
+void FVRSnapshotInterpolationBuffer::AddSnapshot(double Time, double ReceiveTime, const FVector& Position, const FQuat& Rotation)
+{
+	const double NewClockOffset = ReceiveTime - Time;
+
+	// The senders clock restarted (map change or similar) or it stopped / started stamping, start over on the new timeline
+	if (bHasClockOffset && FMath::Abs(NewClockOffset - ClockOffset) > 1.0)
+	{
+		Reset();
+	}
+	// Arrived out of order, we already played past it
+	else if (Snapshots.Num() && Time < Snapshots.Last().Time)
+	{
+		return;
+	}
+
+	// Take the fastest arrival straight away, otherwise slowly relax towards the new offset to follow clock drift
+	if (!bHasClockOffset || NewClockOffset < ClockOffset)
+	{
+		ClockOffset = NewClockOffset;
+		bHasClockOffset = true;
+	}
+	else
+	{
+		ClockOffset += (NewClockOffset - ClockOffset) * 0.01;
+	}
+
+	// Playback ran dry before this one showed up
+	if (bExtrapolating)
+	{
+		++Stats.Underruns;
+		Stats.UnderrunTime += PendingUnderrunTime;
+	}
+
+	bExtrapolating = false;
+	PendingUnderrunTime = 0.0f;
+	++Stats.SnapshotsReceived;
+
+	FQuat NewRotation = Rotation;
+
+	if (Snapshots.Num())
+	{
+		FSnapshot& Newest = Snapshots.Last();
+
+		// Keep them in the same hemisphere for the interpolation
+		NewRotation.EnforceShortestArcWith(Newest.Rotation);
+
+		// Same send time, keep the latest
+		if (Time <= Newest.Time)
+		{
+			Newest.Position = Position;
+			Newest.Rotation = NewRotation;
+			return;
+		}
+
+		if (Snapshots.Num() >= MaxSnapshots)
+		{
+			Snapshots.RemoveAt(0, 1, false);
+		}
+	}
+
+	Snapshots.Add({ Time, Position, NewRotation });
+}
+
+bool FVRSnapshotInterpolationBuffer::Sample(double LocalTime, float PlayoutDelay, float MaxExtrapolationTime, FVector& OutPosition, FQuat& OutRotation)
+{
+	// On the senders timeline
+	const double PlayoutTime = LocalTime - ClockOffset - PlayoutDelay;
+	const float PlayoutDelta = (float)FMath::Max(PlayoutTime - LastPlayoutTime, 0.0);
+	LastPlayoutTime = PlayoutTime;
+
+	const int32 NumSnapshots = Snapshots.Num();
+	if (!NumSnapshots)
+		return false;
+
+	const FSnapshot& Newest = Snapshots.Last();
+
+	Stats.BufferedTime = (float)(Newest.Time - PlayoutTime);
+	if (bHasBufferedSample)
+	{
+		Stats.AverageBufferedTime = FMath::Lerp(Stats.AverageBufferedTime, Stats.BufferedTime, 0.05f);
+		Stats.MinBufferedTime = FMath::Min(Stats.MinBufferedTime, Stats.BufferedTime);
+	}
+	else
+	{
+		Stats.AverageBufferedTime = Stats.BufferedTime;
+		Stats.MinBufferedTime = Stats.BufferedTime;
+		bHasBufferedSample = true;
+	}
+
+	// Still filling the buffer, hold the oldest
+	if (PlayoutTime <= Snapshots[0].Time)
+	{
+		OutPosition = Snapshots[0].Position;
+		OutRotation = Snapshots[0].Rotation;
+		return true;
+	}
+
+	// Ran past the newest snapshot, extrapolate out to the max and then settle back onto it
+	if (PlayoutTime >= Newest.Time)
+	{
+		OutPosition = Newest.Position;
+		OutRotation = Newest.Rotation;
+
+		const float TimePastNewest = (float)(PlayoutTime - Newest.Time);
+		if (NumSnapshots < 2 || MaxExtrapolationTime <= 0.0f || TimePastNewest >= MaxExtrapolationTime * 2.0f)
+		{
+			bExtrapolating = false;
+			PendingUnderrunTime = 0.0f;
+			return false;
+		}
+
+		if (bExtrapolating)
+		{
+			PendingUnderrunTime += PlayoutDelta;
+		}
+
+		bExtrapolating = true;
+
+		const FSnapshot& Previous = Snapshots[NumSnapshots - 2];
+		const float Interval = (float)(Newest.Time - Previous.Time);
+		const float ExtrapolationTime = TimePastNewest <= MaxExtrapolationTime ? TimePastNewest : (MaxExtrapolationTime * 2.0f) - TimePastNewest;
+		const float Alpha = ExtrapolationTime / Interval;
+
+		OutPosition += (Newest.Position - Previous.Position) * Alpha;
+
+		FQuat DeltaRotation = Newest.Rotation * Previous.Rotation.Inverse();
+		DeltaRotation.EnforceShortestArcWith(FQuat::Identity);
+
+		FVector Axis;
+		float Angle;
+		DeltaRotation.ToAxisAndAngle(Axis, Angle);
+		OutRotation = FQuat(Axis, Angle * Alpha) * Newest.Rotation;
+		OutRotation.Normalize();
+		return true;
+	}
+
+	bExtrapolating = false;
+	PendingUnderrunTime = 0.0f;
+
+	// Newest snapshot at or before the playout time
+	int32 Index = NumSnapshots - 2;
+	while (Index > 0 && Snapshots[Index].Time > PlayoutTime)
+	{
+		--Index;
+	}
+
+	const FSnapshot& A = Snapshots[Index];
+	const FSnapshot& B = Snapshots[Index + 1];
+	const bool bHasBefore = Index > 0;
+	const bool bHasAfter = Index + 2 < NumSnapshots;
+
+	const float Interval = (float)(B.Time - A.Time);
+	const float Alpha = FMath::Clamp((float)(PlayoutTime - A.Time) / Interval, 0.0f, 1.0f);
+
+	// Catmull rom tangents from the neighbours where we have them, scaled to this interval
+	const FVector TangentA = bHasBefore ? (B.Position - Snapshots[Index - 1].Position) * (Interval / (float)(B.Time - Snapshots[Index - 1].Time)) : (B.Position - A.Position);
+	const FVector TangentB = bHasAfter ? (Snapshots[Index + 2].Position - A.Position) * (Interval / (float)(Snapshots[Index + 2].Time - A.Time)) : (B.Position - A.Position);
+
+	OutPosition = FMath::CubicInterp(A.Position, TangentA, B.Position, TangentB, Alpha);
+
+	FQuat RotTangentA, RotTangentB;
+	FQuat::CalcTangents(bHasBefore ? Snapshots[Index - 1].Rotation : A.Rotation, A.Rotation, B.Rotation, 0.0f, RotTangentA);
+	FQuat::CalcTangents(A.Rotation, B.Rotation, bHasAfter ? Snapshots[Index + 2].Rotation : B.Rotation, 0.0f, RotTangentB);
+
+	OutRotation = FQuat::Squad(A.Rotation, RotTangentA, B.Rotation, RotTangentB, Alpha);
+	OutRotation.Normalize();
+
+	// Drop what we won't need anymore, keeping one before A for its tangent
+	if (Index > 1)
+	{
+		Snapshots.RemoveAt(0, Index - 1, false);
+	}
+
+	return true;
+}
+
 // ** Euro Low Pass Filter ** //
 
 void FBPEuroLowPassFilter::ResetSmoothingFilter()
@@ -147,6 +147,15 @@ AVRBaseCharacter::AVRBaseCharacter(const FObjectInitializer& ObjectInitializer)
 
 	bUseExperimentalUnseatModeFix = true;
 
+	bUseCoalescedPoseReplication = false;
+	CoalescedPoseNetUpdateRate = 100.0f;
+	CoalescedPoseNetUpdateCount = 0.0f;
+	LastReceivedCoalescedPoseTimestamp = -1.0f;
+
+	CoalescedPoseTickFunction.TickGroup = TG_PostPhysics;
+	CoalescedPoseTickFunction.bCanEverTick = true;
+	CoalescedPoseTickFunction.bStartWithTickEnabled = true;
+
 	ReplicatedMovementVR.Owner = this;
 	bFlagTeleported = false;
 	bTrackingPaused = false;
@@ -199,6 +208,19 @@ void AVRBaseCharacter::PostInitializeComponents()
 			GetCharacterMovement()->UpdateNavAgent(*GetCapsuleComponent());
 		}
 
+		if (bUseCoalescedPoseReplication)
+		{
+			// The components stop sending on their own and we send them all together
+			if (VRReplicatedCamera)
+			{
+				VRReplicatedCamera->bCoalesceTransformSend = true;
+				CoalescedPoseTickFunction.AddPrerequisite(VRReplicatedCamera, VRReplicatedCamera->PrimaryComponentTick);
+			}
+
+			SetCoalescedPoseComponent(LeftMotionController, true);
+			SetCoalescedPoseComponent(RightMotionController, true);
+		}
+
 		if (Controller == nullptr && GetNetMode() != NM_Client)
 		{
 			if (GetCharacterMovement() && GetCharacterMovement()->bRunPhysicsWithNoController)
@@ -345,6 +367,215 @@ bool AVRBaseCharacter::Server_SendTransformRightController_Validate(FBPVRCompone
 	return true;
 	// Optionally check to make sure that player is inside of their bounds and deny it if they aren't?
 }
+
+void AVRBaseCharacter::RegisterActorTickFunctions(bool bRegister)
+{
+	Super::RegisterActorTickFunctions(bRegister);
+
+	if (bRegister)
+	{
+		if (bUseCoalescedPoseReplication && !CoalescedPoseTickFunction.IsTickFunctionRegistered())
+		{
+			CoalescedPoseTickFunction.Target = this;
+			CoalescedPoseTickFunction.RegisterTickFunction(GetLevel());
+		}
+	}
+	else if (CoalescedPoseTickFunction.IsTickFunctionRegistered())
+	{
+		CoalescedPoseTickFunction.UnRegisterTickFunction();
+	}
+}
+
+void AVRBaseCharacter::SetCoalescedPoseComponent(UGripMotionControllerComponent* PoseController, bool bAdd)
+{
+	if (!IsValid(PoseController))
+		return;
+
+	PoseController->bCoalesceTransformSend = bAdd;
+
+	if (bAdd)
+	{
+		CoalescedPoseTickFunction.AddPrerequisite(PoseController, PoseController->PrimaryComponentTick);
+	}
+	else
+	{
+		CoalescedPoseTickFunction.RemovePrerequisite(PoseController, PoseController->PrimaryComponentTick);
+	}
+}
+
+bool AVRBaseCharacter::AddCoalescedPoseController(UGripMotionControllerComponent* ExtraController)
+{
+	if (!bUseCoalescedPoseReplication || !IsValid(ExtraController) || ExtraController == LeftMotionController || ExtraController == RightMotionController)
+		return false;
+
+	// Sent by index as a byte
+	if (CoalescedPoseExtraControllers.Num() >= 255 || CoalescedPoseExtraControllers.Contains(ExtraController))
+		return false;
+
+	CoalescedPoseExtraControllers.Add(ExtraController);
+	SetCoalescedPoseComponent(ExtraController, true);
+	return true;
+}
+
+bool AVRBaseCharacter::RemoveCoalescedPoseController(UGripMotionControllerComponent* ExtraController)
+{
+	int32 Index = CoalescedPoseExtraControllers.IndexOfByKey(ExtraController);
+	if (Index == INDEX_NONE)
+		return false;
+
+	// Keep the order, the server and client need to agree on the indices
+	CoalescedPoseExtraControllers.RemoveAt(Index);
+
+	if (LastSentCoalescedPose.ExtraTransforms.IsValidIndex(Index))
+	{
+		LastSentCoalescedPose.ExtraTransforms.RemoveAt(Index);
+	}
+
+	SetCoalescedPoseComponent(ExtraController, false);
+	return true;
+}
+
+void AVRBaseCharacter::TickCoalescedPose(float DeltaTime)
+{
+	if (!bUseCoalescedPoseReplication || GetNetMode() != NM_Client || !IsLocallyControlled())
+		return;
+
+	CoalescedPoseNetUpdateCount += DeltaTime;
+	if (CoalescedPoseNetUpdateCount < (1.0f / CoalescedPoseNetUpdateRate))
+		return;
+
+	CoalescedPoseNetUpdateCount = 0.0f;
+
+	auto HasChanged = [](const FBPVRComponentPosRep& A, const FBPVRComponentPosRep& B)
+	{
+		return !A.Position.Equals(B.Position) || !A.Rotation.Equals(B.Rotation);
+	};
+
+	// The adaptive encoding is still per controller, it gets resolved in their server send
+	auto GetControllerTransform = [](UGripMotionControllerComponent* PoseController, FBPVRComponentPosRep& OutTransform)
+	{
+		if (PoseController->bUseAdaptiveControllerReplication)
+			PoseController->BuildAdaptiveControllerTransform(OutTransform);
+		else
+			OutTransform = PoseController->ReplicatedControllerTransform;
+
+		// The pose timestamp covers all of them
+		OutTransform.Timestamp = 0.0f;
+	};
+
+	FVRCoalescedPoseRep NewPose;
+	NewPose.Timestamp = GetWorld()->GetTimeSeconds();
+
+	if (VRReplicatedCamera && VRReplicatedCamera->bCoalesceTransformSend && HasChanged(VRReplicatedCamera->ReplicatedCameraTransform, LastSentCoalescedPose.CameraTransform))
+	{
+		NewPose.ComponentFlags |= FVRCoalescedPoseRep::PoseHasCamera;
+		NewPose.CameraTransform = VRReplicatedCamera->ReplicatedCameraTransform;
+		NewPose.CameraTransform.Timestamp = 0.0f;
+		LastSentCoalescedPose.CameraTransform = VRReplicatedCamera->ReplicatedCameraTransform;
+	}
+
+	if (IsValid(LeftMotionController) && LeftMotionController->bCoalesceTransformSend && HasChanged(LeftMotionController->ReplicatedControllerTransform, LastSentCoalescedPose.LeftControllerTransform))
+	{
+		NewPose.ComponentFlags |= FVRCoalescedPoseRep::PoseHasLeftController;
+		GetControllerTransform(LeftMotionController, NewPose.LeftControllerTransform);
+		LastSentCoalescedPose.LeftControllerTransform = LeftMotionController->ReplicatedControllerTransform;
+	}
+
+	if (IsValid(RightMotionController) && RightMotionController->bCoalesceTransformSend && HasChanged(RightMotionController->ReplicatedControllerTransform, LastSentCoalescedPose.RightControllerTransform))
+	{
+		NewPose.ComponentFlags |= FVRCoalescedPoseRep::PoseHasRightController;
+		GetControllerTransform(RightMotionController, NewPose.RightControllerTransform);
+		LastSentCoalescedPose.RightControllerTransform = RightMotionController->ReplicatedControllerTransform;
+	}
+
+	LastSentCoalescedPose.ExtraTransforms.SetNum(CoalescedPoseExtraControllers.Num());
+	for (int32 i = 0; i < CoalescedPoseExtraControllers.Num(); ++i)
+	{
+		UGripMotionControllerComponent* ExtraController = CoalescedPoseExtraControllers[i];
+		if (!IsValid(ExtraController) || !HasChanged(ExtraController->ReplicatedControllerTransform, LastSentCoalescedPose.ExtraTransforms[i]))
+			continue;
+
+		NewPose.ExtraIndices.Add((uint8)i);
+		GetControllerTransform(ExtraController, NewPose.ExtraTransforms.AddDefaulted_GetRef());
+		LastSentCoalescedPose.ExtraTransforms[i] = ExtraController->ReplicatedControllerTransform;
+	}
+
+	// Don't rep if no changes
+	if (NewPose.ComponentFlags == 0 && NewPose.ExtraTransforms.Num() == 0)
+		return;
+
+	Server_SendCoalescedPose(NewPose);
+}
+
+void AVRBaseCharacter::Server_SendCoalescedPose_Implementation(FVRCoalescedPoseRep NewPose)
+{
+	// Older than what we already applied
+	if (NewPose.Timestamp < LastReceivedCoalescedPoseTimestamp)
+		return;
+
+	LastReceivedCoalescedPoseTimestamp = NewPose.Timestamp;
+
+	// Pass the senders time along to the components playing it back with snapshot interpolation on the simulated proxies
+	if (VRReplicatedCamera && VRReplicatedCamera->bUseSnapshotInterpolation)
+		NewPose.CameraTransform.Timestamp = NewPose.Timestamp;
+
+	if (IsValid(LeftMotionController) && LeftMotionController->bUseSnapshotInterpolation)
+		NewPose.LeftControllerTransform.Timestamp = NewPose.Timestamp;
+
+	if (IsValid(RightMotionController) && RightMotionController->bUseSnapshotInterpolation)
+		NewPose.RightControllerTransform.Timestamp = NewPose.Timestamp;
+
+	// Applied all together so that the smoothing on each of them starts on the same frame
+	if ((NewPose.ComponentFlags & FVRCoalescedPoseRep::PoseHasCamera) && VRReplicatedCamera)
+		VRReplicatedCamera->Server_SendCameraTransform_Implementation(NewPose.CameraTransform);
+
+	if ((NewPose.ComponentFlags & FVRCoalescedPoseRep::PoseHasLeftController) && IsValid(LeftMotionController))
+		LeftMotionController->Server_SendControllerTransform_Implementation(NewPose.LeftControllerTransform);
+
+	if ((NewPose.ComponentFlags & FVRCoalescedPoseRep::PoseHasRightController) && IsValid(RightMotionController))
+		RightMotionController->Server_SendControllerTransform_Implementation(NewPose.RightControllerTransform);
+
+	for (int32 i = 0; i < NewPose.ExtraTransforms.Num() && i < NewPose.ExtraIndices.Num(); ++i)
+	{
+		if (CoalescedPoseExtraControllers.IsValidIndex(NewPose.ExtraIndices[i]))
+		{
+			UGripMotionControllerComponent* ExtraController = CoalescedPoseExtraControllers[NewPose.ExtraIndices[i]];
+			if (IsValid(ExtraController))
+			{
+				if (ExtraController->bUseSnapshotInterpolation)
+					NewPose.ExtraTransforms[i].Timestamp = NewPose.Timestamp;
+
+				ExtraController->Server_SendControllerTransform_Implementation(NewPose.ExtraTransforms[i]);
+			}
+		}
+	}
+}
+
+bool AVRBaseCharacter::Server_SendCoalescedPose_Validate(FVRCoalescedPoseRep NewPose)
+{
+	return true;
+	// Optionally check to make sure that player is inside of their bounds and deny it if they aren't?
+}
+
+void FVRCoalescedPoseTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(FVRCoalescedPoseTickFunction_ExecuteTick);
+
+	if (Target && IsValid(Target))
+	{
+		Target->TickCoalescedPose(DeltaTime);
+	}
+}
+
+FString FVRCoalescedPoseTickFunction::DiagnosticMessage()
+{
+	return TEXT("VRCoalescedPoseTickFunction");
+}
+
+FName FVRCoalescedPoseTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return FName(TEXT("VRCoalescedPose"));
+}
 FVector AVRBaseCharacter::GetTeleportLocation(FVector OriginalLocation)
 {	
 	return OriginalLocation;
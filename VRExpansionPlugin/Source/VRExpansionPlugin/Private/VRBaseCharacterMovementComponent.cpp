@@ -19,10 +19,14 @@
 #include "Navigation/PathFollowingComponent.h"
 #include "VRPlayerController.h"
 #include "GameFramework/PhysicsVolume.h"
+#include "Camera/PlayerCameraManager.h"
 
 
 DEFINE_LOG_CATEGORY(LogVRBaseCharacterMovement);
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Char FloorCache Hits"), STAT_CharFloorCacheHits, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Char FloorCache Misses"), STAT_CharFloorCacheMisses, STATGROUP_Character);
+
 UVRBaseCharacterMovementComponent::UVRBaseCharacterMovementComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -57,6 +61,20 @@ UVRBaseCharacterMovementComponent::UVRBaseCharacterMovementComponent(const FObje
 
 	bIgnoreSimulatingComponentsInFloorCheck = true;
 
+	bUseRoomscaleMoveCombining = false;
+	RoomscaleCombineMaxError = 1.0f;
+	RoomscaleCombineHeightTolerance = 2.0f;
+
+	bUseDeltaCompressedMoveData = false;
+	MoveDataLFDiffQuantization = EVRMoveDataLFDiffQuantization::MatchRoomscaleMode;
+
+	bUseFloorCache = false;
+	FloorCacheCellSize = 1.0f;
+	FloorCacheHeightTolerance = 0.5f;
+	FloorCacheMaxAge = 0.25f;
+	FloorCacheHits = 0;
+	FloorCacheQueries = 0;
+
 	VRWallSlideScaler = 1.0f;
 	VRLowGravWallFrictionScaler = 1.0f;
 	VRLowGravIgnoresDefaultFluidFriction = true;
@@ -81,6 +99,17 @@ UVRBaseCharacterMovementComponent::UVRBaseCharacterMovementComponent(const FObje
 
 	bUseClientControlRotation = true;
 	bDisableSimulatedTickWhenSmoothingMovement = true;
+
+	bUseSimulatedProxyLOD = false;
+	SimulatedProxyLODMediumDistance = 1500.f;
+	SimulatedProxyLODFarDistance = 4000.f;
+	SimulatedProxyLODMediumUpdateRate = 30.f;
+	SimulatedProxyLODFarUpdateRate = 10.f;
+	bSimulatedProxyLODUseVisibility = true;
+	SimulatedProxyLODOffscreenTime = 0.5f;
+	SimulatedProxyLOD = EVRSimulatedProxyLOD::Full;
+	SimulatedProxyLODAccumulatedTime = 0.f;
+
 	bCapHMDMovementToMaxMovementSpeed = false;
 
 	SetNetworkMoveDataContainer(VRNetworkMoveDataContainer);
@@ -503,6 +532,103 @@ void UVRBaseCharacterMovementComponent::OnMoveCompleted(FAIRequestID RequestID,
 }
 
 void UVRBaseCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, FFindFloorResult& OutFloorResult, float SweepRadius, const FHitResult* DownwardSweepResult) const
+{
+	// A supplied downward sweep is already free
+	if (!bUseFloorCache || DownwardSweepResult != NULL)
+	{
+		ComputeFloorDistUncached(CapsuleLocation, LineDistance, SweepDistance, OutFloorResult, SweepRadius, DownwardSweepResult);
+		return;
+	}
+
+	UPrimitiveComponent* MovementBase = CharacterOwner->GetMovementBase();
+	const UWorld* MyWorld = GetWorld();
+	const double WorldTime = MyWorld ? MyWorld->GetTimeSeconds() : 0.0;
+	const float CellSize = FMath::Max(FloorCacheCellSize, UE_KINDA_SMALL_NUMBER);
+	const FIntPoint Cell(FMath::FloorToInt(CapsuleLocation.X / CellSize), FMath::FloorToInt(CapsuleLocation.Y / CellSize));
+
+	// Moving bases can change the floor under us without the capsule moving
+	const bool bCanUseCache = !bJustTeleported && MovementBase && !MovementBaseUtility::IsDynamicBase(MovementBase);
+
+	++FloorCacheQueries;
+
+	if (bCanUseCache && FloorCache.bValid &&
+		FloorCache.Base.Get() == MovementBase &&
+		FloorCache.Cell == Cell &&
+		FloorCache.LineDistance == LineDistance &&
+		FloorCache.SweepDistance == SweepDistance &&
+		FloorCache.SweepRadius == SweepRadius &&
+		FMath::Abs(CapsuleLocation.Z - FloorCache.CapsuleLocation.Z) <= FloorCacheHeightTolerance &&
+		(WorldTime - FloorCache.Time) <= FloorCacheMaxAge)
+	{
+		INC_DWORD_STAT(STAT_CharFloorCacheHits);
+		++FloorCacheHits;
+
+		// Shift the cached result over to where the capsule is now, the floor itself hasn't moved
+		const FVector Offset = CapsuleLocation - FloorCache.CapsuleLocation;
+		OutFloorResult = FloorCache.FloorResult;
+
+		// Follow the cached floor plane for the sideways move, on slopes the floor height under the new XY is different
+		const FVector PlanarOffset(Offset.X, Offset.Y, 0.f);
+		const FVector& FloorNormal = OutFloorResult.HitResult.ImpactNormal;
+		const float FloorRise = FloorNormal.Z > UE_KINDA_SMALL_NUMBER ? -(PlanarOffset | FloorNormal) / FloorNormal.Z : 0.f;
+		const FVector FloorOffset(PlanarOffset.X, PlanarOffset.Y, FloorRise);
+
+		OutFloorResult.FloorDist += Offset.Z - FloorRise;
+
+		if (OutFloorResult.bLineTrace)
+		{
+			OutFloorResult.LineDist += Offset.Z - FloorRise;
+		}
+
+		OutFloorResult.HitResult.Location += FloorOffset;
+		OutFloorResult.HitResult.ImpactPoint += FloorOffset;
+		OutFloorResult.HitResult.TraceStart += Offset;
+		OutFloorResult.HitResult.TraceEnd += Offset;
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_CharFloorCacheMisses);
+
+	ComputeFloorDistUncached(CapsuleLocation, LineDistance, SweepDistance, OutFloorResult, SweepRadius, DownwardSweepResult);
+
+	// Only keep walkable floors that are still our base, anything else is about to change the movement anyway
+	if (bCanUseCache && OutFloorResult.IsWalkableFloor() && !OutFloorResult.HitResult.bStartPenetrating && OutFloorResult.HitResult.GetComponent() == MovementBase)
+	{
+		FloorCache.FloorResult = OutFloorResult;
+		FloorCache.CapsuleLocation = CapsuleLocation;
+		FloorCache.Cell = Cell;
+		FloorCache.Base = MovementBase;
+		FloorCache.LineDistance = LineDistance;
+		FloorCache.SweepDistance = SweepDistance;
+		FloorCache.SweepRadius = SweepRadius;
+		FloorCache.Time = WorldTime;
+		FloorCache.bValid = true;
+	}
+	else
+	{
+		FloorCache.Invalidate();
+	}
+}
+
+float UVRBaseCharacterMovementComponent::GetFloorCacheHitRate(int32& OutHits, int32& OutQueries) const
+{
+	OutHits = FloorCacheHits;
+	OutQueries = FloorCacheQueries;
+	return FloorCacheQueries > 0 ? (float)FloorCacheHits / (float)FloorCacheQueries : 0.f;
+}
+
+void UVRBaseCharacterMovementComponent::ResetFloorCacheStats()
+{
+	FloorCacheHits = 0;
+	FloorCacheQueries = 0;
+}
+
+void UVRBaseCharacterMovementComponent::InvalidateFloorCache()
+{
+	FloorCache.Invalidate();
+}
+
+void UVRBaseCharacterMovementComponent::ComputeFloorDistUncached(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, FFindFloorResult& OutFloorResult, float SweepRadius, const FHitResult* DownwardSweepResult) const
 {
 	UE_LOG(LogVRBaseCharacterMovement, VeryVerbose, TEXT("[Role:%d] ComputeFloorDist: %s at location %s"), (int32)CharacterOwner->GetLocalRole(), *GetNameSafe(CharacterOwner), *CapsuleLocation.ToString());
 	OutFloorResult.Clear();
@@ -1503,6 +1629,36 @@ void UVRBaseCharacterMovementComponent::SimulatedTick(float DeltaSeconds)
 	QUICK_SCOPE_CYCLE_COUNTER(STAT_Character_CharacterMovementSimulated);
 	checkSlow(CharacterOwner != nullptr);
 
+	if (bUseSimulatedProxyLOD && CharacterOwner->GetLocalRole() == ROLE_SimulatedProxy && !CharacterOwner->IsPlayingNetworkedRootMotionMontage())
+	{
+		SimulatedProxyLOD = GetDesiredSimulatedProxyLOD();
+
+		float UpdateRate = 0.f;
+		if (SimulatedProxyLOD == EVRSimulatedProxyLOD::Medium)
+		{
+			UpdateRate = SimulatedProxyLODMediumUpdateRate;
+		}
+		else if (SimulatedProxyLOD == EVRSimulatedProxyLOD::Far)
+		{
+			UpdateRate = SimulatedProxyLODFarUpdateRate;
+		}
+
+		// Skip this frame and run the simulation and smoothing with the accumulated time once the interval is up
+		SimulatedProxyLODAccumulatedTime += DeltaSeconds;
+		if (UpdateRate > 0.f && SimulatedProxyLODAccumulatedTime < (1.f / UpdateRate))
+		{
+			return;
+		}
+
+		DeltaSeconds = SimulatedProxyLODAccumulatedTime;
+		SimulatedProxyLODAccumulatedTime = 0.f;
+	}
+	else
+	{
+		SimulatedProxyLOD = EVRSimulatedProxyLOD::Full;
+		SimulatedProxyLODAccumulatedTime = 0.f;
+	}
+
 	// If we are playing a RootMotion AnimMontage.
 	if (CharacterOwner->IsPlayingNetworkedRootMotionMontage())
 	{
@@ -1701,7 +1857,14 @@ void UVRBaseCharacterMovementComponent::SimulatedTick(float DeltaSeconds)
 	if (!bNetworkSmoothingComplete)
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_Character_CharacterMovementSmoothClientPosition);
-		SmoothClientPosition(DeltaSeconds);
+		if (SimulatedProxyLOD == EVRSimulatedProxyLOD::Far)
+		{
+			SmoothClientPosition_Snap();
+		}
+		else
+		{
+			SmoothClientPosition(DeltaSeconds);
+		}
 	}
 	else
 	{
@@ -1995,6 +2158,48 @@ void UVRBaseCharacterMovementComponent::SmoothClientPosition(float DeltaSeconds)
 	SmoothClientPosition_UpdateVRVisuals();
 }
 
+void UVRBaseCharacterMovementComponent::SmoothClientPosition_Snap()
+{
+	FNetworkPredictionData_Client_Character* ClientData = GetPredictionData_Client_Character();
+	if (!ClientData)
+		return;
+
+	// Long enough for both linear and exponential smoothing to reach their target in a single interpolation
+	const float SnapTime = FMath::Max3(ClientData->SmoothNetUpdateTime, ClientData->SmoothNetUpdateRotationTime, ClientData->MaxClientSmoothingDeltaTime) + UE_KINDA_SMALL_NUMBER;
+	SmoothClientPosition(SnapTime);
+}
+
+EVRSimulatedProxyLOD UVRBaseCharacterMovementComponent::GetDesiredSimulatedProxyLOD() const
+{
+	if (!CharacterOwner || !UpdatedComponent)
+		return EVRSimulatedProxyLOD::Full;
+
+	if (bSimulatedProxyLODUseVisibility && !CharacterOwner->WasRecentlyRendered(SimulatedProxyLODOffscreenTime))
+	{
+		return EVRSimulatedProxyLOD::Far;
+	}
+
+	const UWorld* MyWorld = GetWorld();
+	const APlayerController* PC = MyWorld ? MyWorld->GetFirstPlayerController() : nullptr;
+
+	// No local view to measure from
+	if (!PC || !PC->PlayerCameraManager)
+		return EVRSimulatedProxyLOD::Full;
+
+	const double DistSq = FVector::DistSquared(PC->PlayerCameraManager->GetCameraLocation(), UpdatedComponent->GetComponentLocation());
+
+	if (DistSq >= FMath::Square(SimulatedProxyLODFarDistance))
+	{
+		return EVRSimulatedProxyLOD::Far;
+	}
+	else if (DistSq >= FMath::Square(SimulatedProxyLODMediumDistance))
+	{
+		return EVRSimulatedProxyLOD::Medium;
+	}
+
+	return EVRSimulatedProxyLOD::Full;
+}
+
 void UVRBaseCharacterMovementComponent::SmoothClientPosition_UpdateVRVisuals()
 {
 	//SCOPE_CYCLE_COUNTER(STAT_CharacterMovementSmoothClientPosition_Visual);
@@ -31,6 +31,8 @@
 #include "Engine/NetworkObjectList.h"
 
 #include "VRRootComponent.h"
+#include "VRGlobalSettings.h"
+#include "Misc/VRServerMoveBatchSubsystem.h"
 #include "WorldCollision.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "GameFramework/CharacterMovementReplication.h"
@@ -1403,6 +1405,7 @@ UVRCharacterMovementComponent::UVRCharacterMovementComponent(const FObjectInitia
 	bAllowMovementMerging = true;
 	bRunClientCorrectionToHMD = false;
 	bRequestedMoveUseAcceleration = false;
+	QueuedServerMoveDeferredFrames = 0;
 }
 
 void UVRCharacterMovementComponent::OnRegister()
@@ -1421,6 +1424,85 @@ void UVRCharacterMovementComponent::OnRegister()
 	}
 }
 
+void UVRCharacterMovementComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Only the server receives moves
+	const UVRGlobalSettings* VRSettings = GetDefault<UVRGlobalSettings>();
+	if (VRSettings->bUseBatchedServerMoves && GetNetMode() < NM_Client && GetNetMode() != NM_Standalone)
+	{
+		if (UWorld* World = GetWorld())
+		{
+			UVRServerMoveBatchSubsystem* BatchSubsystem = World->GetSubsystem<UVRServerMoveBatchSubsystem>();
+			if (BatchSubsystem && BatchSubsystem->RegisterMovementComponent(this))
+			{
+				ServerMoveBatchSubsystem = BatchSubsystem;
+			}
+		}
+	}
+}
+
+void UVRCharacterMovementComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UVRServerMoveBatchSubsystem* BatchSubsystem = ServerMoveBatchSubsystem.Get())
+	{
+		BatchSubsystem->UnregisterMovementComponent(this);
+	}
+	ServerMoveBatchSubsystem.Reset();
+
+	// The package map these were read with may not outlive us
+	QueuedServerMoves.Empty();
+	QueuedServerMoveDeferredFrames = 0;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UVRCharacterMovementComponent::ServerMovePacked_ServerReceive(const FCharacterServerMovePackedBits& PackedBits)
+{
+	if (!ServerMoveBatchSubsystem.IsValid() || !HasValidData() || !IsActive())
+	{
+		Super::ServerMovePacked_ServerReceive(PackedBits);
+		return;
+	}
+
+	QueuedServerMoves.Add(PackedBits);
+}
+
+bool UVRCharacterMovementComponent::DeferQueuedServerMoves(int32 MaxDeferredFrames)
+{
+	if (++QueuedServerMoveDeferredFrames > FMath::Max(0, MaxDeferredFrames))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+void UVRCharacterMovementComponent::ProcessQueuedServerMoves()
+{
+	QueuedServerMoveDeferredFrames = 0;
+
+	if (!QueuedServerMoves.Num())
+		return;
+
+	// Swap out first, processing a move can end up back in here through the owner
+	TArray<FCharacterServerMovePackedBits> MovesToProcess = MoveTemp(QueuedServerMoves);
+	QueuedServerMoves.Reset();
+
+	// The connection went away while these were queued, their package map is no longer safe to read from
+	if (!CharacterOwner || !CharacterOwner->GetNetConnection())
+		return;
+
+	for (const FCharacterServerMovePackedBits& PackedBits : MovesToProcess)
+	{
+		if (!HasValidData() || !IsActive())
+			break;
+
+		Super::ServerMovePacked_ServerReceive(PackedBits);
+	}
+}
+
 
 void UVRCharacterMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
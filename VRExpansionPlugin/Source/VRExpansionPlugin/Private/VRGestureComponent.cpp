@@ -27,6 +27,11 @@ UVRGestureComponent::UVRGestureComponent(const FObjectInitializer& ObjectInitial
 	bDrawSplinesCurved = true;
 	bGetGestureInWorldSpace = true;
 	SplineMeshScaler = FVector2D(1.f);
+	bUseStreamingDetection = false;
+	StreamingRescaleTolerance = 0.05f;
+	bUseAsyncDetection = false;
+	TotalCapturedSamples = 0;
+	RecordingSerial = 0;
 }
 
 void UGesturesDatabase::FillSplineWithGesture(FVRGesture &Gesture, USplineComponent * SplineComponent, bool bCenterPointsOnSpline, bool bScaleToBounds, float OptionalBounds, bool bUseCurvedPoints, bool bFillInSplineMeshComponents, UStaticMesh * Mesh, UMaterial * MeshMat)
@@ -136,6 +141,9 @@ void UVRGestureComponent::BeginRecording(bool bRunDetection, bool bFlattenGestur
 
 	// Reset does the reserve already
 	GestureLog.Samples.Reset(RecordingBufferSize);
+	TotalCapturedSamples = 0;
+	RecordingSerial++;
+	InvalidateGestureStreams();
 
 	CurrentState = bRunDetection ? EVRGestureState::GES_Detecting : EVRGestureState::GES_Recording;
 
@@ -335,6 +343,7 @@ void UVRGestureComponent::CaptureGestureFrame()
 		}
 
 		GestureLog.Samples.Insert(NewSample, 0);
+		TotalCapturedSamples++;
 		bGestureChanged = true;
 	}
 }
@@ -347,9 +356,19 @@ void UVRGestureComponent::TickGesture()
 	{
 	case EVRGestureState::GES_Detecting:
 	{
-		CaptureGestureFrame();
-		RecognizeGesture(GestureLog);
-		bGestureChanged = false;
+		if (bUseAsyncDetection)
+		{
+			// Last ticks result comes in first, if it detected something the buffer is cleared before the new capture
+			ConsumeAsyncRecognition();
+			CaptureGestureFrame();
+			LaunchAsyncRecognition(GestureLog);
+		}
+		else
+		{
+			CaptureGestureFrame();
+			RecognizeGesture(GestureLog);
+			bGestureChanged = false;
+		}
 	}break;
 
 	case EVRGestureState::GES_Recording:
@@ -372,7 +391,7 @@ void UVRGestureComponent::TickGesture()
 	}
 }
 
-void UVRGestureComponent::RecognizeGesture(FVRGesture inputGesture)
+void UVRGestureComponent::RecognizeGesture(const FVRGesture& inputGesture)
 {
 	if (!GesturesDB || inputGesture.Samples.Num() < 1 || !bGestureChanged)
 		return;
@@ -386,6 +405,19 @@ void UVRGestureComponent::RecognizeGesture(FVRGesture inputGesture)
 	float Scaler = GesturesDB->TargetGestureScale / Size.GetMax();
 	float FinalScaler = Scaler;
 
+	if (bUseStreamingDetection && (StreamedDatabase.Get() != GesturesDB || GestureStreams.Num() != GesturesDB->Gestures.Num() * 2))
+	{
+		// Database changed out from under us, start the streams over
+		StreamedDatabase = GesturesDB;
+		GestureStreams.Reset();
+		GestureStreams.SetNum(GesturesDB->Gestures.Num() * 2);
+	}
+
+	// The recorded bounds contain every sample that is still in the buffer, so they work as the envelope of the input
+	const FBox InputBounds(inputGesture.GestureSize.Min, inputGesture.GestureSize.Max);
+
+	MatchCandidates.Reset();
+
 	for (int i = 0; i < GesturesDB->Gestures.Num(); i++)
 	{
 		FVRGesture &exampleGesture = GesturesDB->Gestures[i];
@@ -397,43 +429,65 @@ void UVRGestureComponent::RecognizeGesture(FVRGesture inputGesture)
 
 		bMirrorGesture = (MirroringHand != EVRGestureMirrorMode::GES_NoMirror && MirroringHand != EVRGestureMirrorMode::GES_MirrorBoth && MirroringHand == exampleGesture.GestureSettings.MirrorMode);
 
-		if (GetGestureDistance(inputGesture.Samples[0] * FinalScaler, exampleGesture.Samples[0], bMirrorGesture) < FMath::Square(exampleGesture.GestureSettings.firstThreshold))
+		if (GetGestureDistance(inputGesture.Samples[0] * FinalScaler, exampleGesture.Samples[0], bMirrorGesture) >= FMath::Square(exampleGesture.GestureSettings.firstThreshold))
 		{
-			float d = dtw(inputGesture, exampleGesture, bMirrorGesture, FinalScaler) / (exampleGesture.Samples.Num());
-			if (d < minDist && d < FMath::Square(exampleGesture.GestureSettings.FullThreshold))
-			{
-				minDist = d;
-				OutGestureIndex = i;
-			}
+			if (exampleGesture.GestureSettings.MirrorMode != EVRGestureMirrorMode::GES_MirrorBoth)
+				continue;
+
+			bMirrorGesture = true;
+			if (GetGestureDistance(inputGesture.Samples[0] * FinalScaler, exampleGesture.Samples[0], bMirrorGesture) >= FMath::Square(exampleGesture.GestureSettings.firstThreshold))
+				continue;
 		}
-		else if (exampleGesture.GestureSettings.MirrorMode == EVRGestureMirrorMode::GES_MirrorBoth)
+
+		if (exampleGesture.EnvelopeSampleCount != exampleGesture.Samples.Num())
 		{
-			bMirrorGesture = true;
-			if (GetGestureDistance(inputGesture.Samples[0] * FinalScaler, exampleGesture.Samples[0], bMirrorGesture) < FMath::Square(exampleGesture.GestureSettings.firstThreshold))
-			{
-				float d = dtw(inputGesture, exampleGesture, bMirrorGesture, FinalScaler) / (exampleGesture.Samples.Num());
-				if (d < minDist && d < FMath::Square(exampleGesture.GestureSettings.FullThreshold))
-				{
-					minDist = d;
-					OutGestureIndex = i;
-				}
-			}
+			// Samples were edited (or added / removed) without recalculating the gesture
+			exampleGesture.CalculateEnvelope();
 		}
 
-		/*if (exampleGesture.MirrorMode == EVRGestureMirrorMode::GES_MirrorBoth)
+		const float GestureLength = (float)exampleGesture.Samples.Num();
+		const float FullCost = FMath::Square(exampleGesture.GestureSettings.FullThreshold) * GestureLength;
+		const FBox ScaledInputBounds(InputBounds.Min * FinalScaler, InputBounds.Max * FinalScaler);
+
+		float LowerBound = GetGestureLowerBound(exampleGesture, ScaledInputBounds, bMirrorGesture, FullCost);
+		if (LowerBound >= FullCost)
+			continue;
+
+		MatchCandidates.Add(FVRGestureMatchCandidate(i, bMirrorGesture, FinalScaler, LowerBound / GestureLength));
+	}
+
+	// Check the most promising gestures first so that the best match tightens quickly and the rest can be skipped or abandoned
+	MatchCandidates.Sort([](const FVRGestureMatchCandidate& A, const FVRGestureMatchCandidate& B)
+	{
+		return A.LowerBound < B.LowerBound;
+	});
+
+	for (const FVRGestureMatchCandidate& Candidate : MatchCandidates)
+	{
+		// Sorted, nothing after this can beat our current match
+		if (Candidate.LowerBound >= minDist)
+			break;
+
+		FVRGesture& exampleGesture = GesturesDB->Gestures[Candidate.GestureIndex];
+		const float GestureLength = (float)exampleGesture.Samples.Num();
+		const float FullThresholdSquared = FMath::Square(exampleGesture.GestureSettings.FullThreshold);
+
+		float d = MAX_FLT;
+		if (bUseStreamingDetection)
 		{
-			bMirrorGesture = true;
+			// Skipped streams catch up on their next update, they only rebuild if they fell out of the buffer
+			d = UpdateGestureStream(GestureStreams[Candidate.GestureIndex * 2 + (Candidate.bMirrored ? 1 : 0)], inputGesture, exampleGesture, Candidate.bMirrored, Candidate.Scaler) / GestureLength;
+		}
+		else
+		{
+			d = dtw(inputGesture, exampleGesture, Candidate.bMirrored, Candidate.Scaler, FMath::Min(minDist, FullThresholdSquared) * GestureLength) / GestureLength;
+		}
 
-			if (GetGestureDistance(inputGesture.Samples[0], exampleGesture.Samples[0], bMirrorGesture) < FMath::Square(exampleGesture.GestureSettings.firstThreshold))
-			{
-				float d = dtw(inputGesture, exampleGesture, bMirrorGesture) / (exampleGesture.Samples.Num());
-				if (d < minDist && d < FMath::Square(exampleGesture.GestureSettings.FullThreshold))
-				{
-					minDist = d;
-					OutGestureIndex = i;
-				}
-			}
-		}*/
+		if (d < minDist && d < FullThresholdSquared)
+		{
+			minDist = d;
+			OutGestureIndex = Candidate.GestureIndex;
+		}
 	}
 
 	if (/*minDist < FMath::Square(globalThreshold) && */OutGestureIndex != -1)
@@ -445,7 +499,7 @@ void UVRGestureComponent::RecognizeGesture(FVRGesture inputGesture)
 	}
 }
 
-float UVRGestureComponent::dtw(FVRGesture seq1, FVRGesture seq2, bool bMirrorGesture, float Scaler)
+float UVRGestureComponent::dtw(const FVRGesture& seq1, const FVRGesture& seq2, bool bMirrorGesture, float Scaler, float AbandonCost)
 {
 
 	// #TODO: Skip copying the array and reversing it in the future, we only ever use the reversed value.
@@ -458,27 +512,37 @@ float UVRGestureComponent::dtw(FVRGesture seq1, FVRGesture seq2, bool bMirrorGes
 
 	int RowCount = seq1.Samples.Num() + 1;
 	int ColumnCount = seq2.Samples.Num() + 1;
+	int TableSize = ColumnCount * RowCount;
+
+	// Re-use the scratch tables, they only grow
+	DTWLookupTable.SetNumUninitialized(TableSize, false);
+	DTWSlopeI.SetNumUninitialized(TableSize, false);
+	DTWSlopeJ.SetNumUninitialized(TableSize, false);
 
-	TArray<float> LookupTable;
-	LookupTable.AddZeroed(ColumnCount * RowCount);
+	float* LookupTable = DTWLookupTable.GetData();
+	int* SlopeI = DTWSlopeI.GetData();
+	int* SlopeJ = DTWSlopeJ.GetData();
 
-	TArray<int> SlopeI;
-	SlopeI.AddZeroed(ColumnCount * RowCount);
-	TArray<int> SlopeJ;
-	SlopeJ.AddZeroed(ColumnCount * RowCount);
+	FMemory::Memzero(SlopeI, TableSize * sizeof(int));
+	FMemory::Memzero(SlopeJ, TableSize * sizeof(int));
 
-	for (int i = 1; i < (ColumnCount * RowCount); i++)
+	LookupTable[0] = 0.f;
+	for (int i = 1; i < TableSize; i++)
 	{
 		LookupTable[i] = MAX_FLT;
 	}
-	// Don't need to do this, it is already handled by add zeroed
-	//tab[0, 0] = 0;
 
 	int icol = 0, icolneg = 0;
+	float RowMin = MAX_FLT;
+
+	// Find best between seq2 and an ending (postfix) of seq1.
+	float bestMatch = FLT_MAX;
 
 	// Dynamic computation of the DTW matrix.
 	for (int i = 1; i < RowCount; i++)
 	{
+		RowMin = MAX_FLT;
+
 		for (int j = 1; j < ColumnCount; j++)
 		{
 			icol = i * ColumnCount;
@@ -508,21 +572,501 @@ float UVRGestureComponent::dtw(FVRGesture seq1, FVRGesture seq2, bool bMirrorGes
 				SlopeI[icol + j] = 0;
 				SlopeJ[icol + j] = 0;
 			}
+
+			RowMin = FMath::Min(RowMin, LookupTable[icol + j]);
 		}
+
+		if (LookupTable[icol + seq2.Samples.Num()] < bestMatch)
+			bestMatch = LookupTable[icol + seq2.Samples.Num()];
+
+		// Every path into the following rows passes through this one and costs are never negative,
+		// so once the whole row is over the abandon cost nothing later can come in under it.
+		if (RowMin >= AbandonCost)
+			break;
 	}
 
-	// Find best between seq2 and an ending (postfix) of seq1.
-	float bestMatch = FLT_MAX;
+	return bestMatch;
+}
+
+float UVRGestureComponent::GetGestureLowerBound(const FVRGesture& exampleGesture, const FBox& ScaledInputBounds, bool bMirrorGesture, float AbandonCost)
+{
+	// Distances are mirrored on the gesture side, mirroring the input bounds instead gives the same result
+	FBox InputBounds = ScaledInputBounds;
+	if (bMirrorGesture)
+	{
+		InputBounds.Min.Y = -ScaledInputBounds.Max.Y;
+		InputBounds.Max.Y = -ScaledInputBounds.Min.Y;
+	}
+
+	// Cheapest test first, every gesture sample is at least the gap between the two boxes away from the input
+	const FBox& Envelope = exampleGesture.SampleEnvelope;
+	FVector Gap = FVector::ZeroVector;
+	Gap.X = FMath::Max3(0.0, Envelope.Min.X - InputBounds.Max.X, InputBounds.Min.X - Envelope.Max.X);
+	Gap.Y = FMath::Max3(0.0, Envelope.Min.Y - InputBounds.Max.Y, InputBounds.Min.Y - Envelope.Max.Y);
+	Gap.Z = FMath::Max3(0.0, Envelope.Min.Z - InputBounds.Max.Z, InputBounds.Min.Z - Envelope.Max.Z);
+
+	float LowerBound = Gap.SizeSquared() * exampleGesture.Samples.Num();
+	if (LowerBound >= AbandonCost)
+		return LowerBound;
+
+	// Tighter per sample bound, stops as soon as it passes the abandon cost
+	LowerBound = 0.f;
+	for (const FVector& Sample : exampleGesture.Samples)
+	{
+		LowerBound += InputBounds.ComputeSquaredDistanceToPoint(Sample);
+
+		if (LowerBound >= AbandonCost)
+			break;
+	}
+
+	return LowerBound;
+}
+
+float UVRGestureComponent::UpdateGestureStream(FVRGestureDTWStream& Stream, const FVRGesture& inputGesture, const FVRGesture& exampleGesture, bool bMirrorGesture, float Scaler)
+{
+	// The input is expected to be our GestureLog, it is stored newest first and holds the last Num() captured samples
+	const int NumSamples = inputGesture.Samples.Num();
+	const int NewSamples = TotalCapturedSamples - Stream.ConsumedSamples;
+
+	bool bRebuild =
+		Stream.bNeedsRebuild ||
+		Stream.bMirrored != bMirrorGesture ||
+		Stream.GestureLength != exampleGesture.Samples.Num() ||
+		NewSamples < 0 ||
+		NewSamples > NumSamples;
+
+	// The input scaler shifts as the recorded bounds grow, everything in the column was computed with the old one
+	if (!bRebuild && Stream.Scaler != Scaler)
+	{
+		bRebuild = FMath::Abs(Scaler - Stream.Scaler) > StreamingRescaleTolerance * FMath::Abs(Stream.Scaler);
+	}
+
+	if (bRebuild)
+	{
+		Stream.Init(exampleGesture.Samples.Num(), bMirrorGesture, Scaler, TotalCapturedSamples - NumSamples);
+
+		// Replay the entire buffer, oldest first
+		for (int i = NumSamples - 1; i >= 0; --i)
+		{
+			PushStreamSample(Stream, exampleGesture, inputGesture.Samples[i]);
+		}
+	}
+	else
+	{
+		for (int i = NewSamples - 1; i >= 0; --i)
+		{
+			PushStreamSample(Stream, exampleGesture, inputGesture.Samples[i]);
+		}
+	}
+
+	// Don't allow paths that began on samples that have already fallen out of the recording buffer
+	return Stream.GetMatchCost(TotalCapturedSamples - NumSamples);
+}
+
+void UVRGestureComponent::PushStreamSample(FVRGestureDTWStream& Stream, const FVRGesture& exampleGesture, const FVector& Sample)
+{
+	const int PrevIndex = Stream.CurrentColumn;
+	const int CurIndex = PrevIndex ^ 1;
+
+	const float* PrevCost = Stream.CostColumns[PrevIndex].GetData();
+	const int* PrevSlopeI = Stream.SlopeIColumns[PrevIndex].GetData();
+	const int* PrevSlopeJ = Stream.SlopeJColumns[PrevIndex].GetData();
+	const int* PrevStart = Stream.StartColumns[PrevIndex].GetData();
+
+	float* CurCost = Stream.CostColumns[CurIndex].GetData();
+	int* CurSlopeI = Stream.SlopeIColumns[CurIndex].GetData();
+	int* CurSlopeJ = Stream.SlopeJColumns[CurIndex].GetData();
+	int* CurStart = Stream.StartColumns[CurIndex].GetData();
+
+	const FVector ScaledSample = Sample * Stream.Scaler;
+	const int GestureLength = Stream.GestureLength;
+
+	// Free start, a match is allowed to begin on the next sample
+	CurCost[0] = 0.f;
+	CurSlopeI[0] = 0;
+	CurSlopeJ[0] = 0;
+	CurStart[0] = Stream.ConsumedSamples + 1;
+
+	for (int j = 1; j <= GestureLength; j++)
+	{
+		// Gesture samples are stored in reverse order, walk them from the first drawn point
+		const float SampleCost = GetGestureDistance(ScaledSample, exampleGesture.Samples[GestureLength - j], Stream.bMirrored);
+
+		const float Left = CurCost[j - 1];
+		const float Up = PrevCost[j];
+		const float Diag = PrevCost[j - 1];
+
+		if (Left < Diag && Left < Up && CurSlopeI[j - 1] < maxSlope)
+		{
+			CurCost[j] = SampleCost + Left;
+			CurSlopeI[j] = CurSlopeI[j - 1] + 1;
+			CurSlopeJ[j] = 0;
+			CurStart[j] = CurStart[j - 1];
+		}
+		else if (Up < Diag && Up < Left && PrevSlopeJ[j] < maxSlope)
+		{
+			CurCost[j] = SampleCost + Up;
+			CurSlopeI[j] = 0;
+			CurSlopeJ[j] = PrevSlopeJ[j] + 1;
+			CurStart[j] = PrevStart[j];
+		}
+		else
+		{
+			CurCost[j] = SampleCost + Diag;
+			CurSlopeI[j] = 0;
+			CurSlopeJ[j] = 0;
+			CurStart[j] = PrevStart[j - 1];
+		}
+	}
+
+	Stream.CurrentColumn = CurIndex;
+	Stream.ConsumedSamples++;
+}
+
+void UVRGestureComponent::LaunchAsyncRecognition(const FVRGesture& inputGesture)
+{
+	// Still waiting on the last one, bGestureChanged stays set so we launch on a later tick
+	if (RecognitionTask.IsValid() || !bGestureChanged)
+		return;
+
+	bGestureChanged = false;
+
+	if (!GesturesDB || inputGesture.Samples.Num() < 1)
+		return;
+
+	if (!RecognitionJob.IsValid())
+	{
+		RecognitionJob = MakeShared<FVRGestureRecognitionJob, ESPMode::ThreadSafe>();
+	}
+
+	FVRGestureRecognitionJob& Job = *RecognitionJob;
+	Job.BakedDatabase = GesturesDB->GetBakedGestures();
+	Job.SourceDatabase = GesturesDB;
+	Job.RecordingSerial = RecordingSerial;
+
+	const int NumSamples = inputGesture.Samples.Num();
+	Job.InputX.SetNumUninitialized(NumSamples, false);
+	Job.InputY.SetNumUninitialized(NumSamples, false);
+	Job.InputZ.SetNumUninitialized(NumSamples, false);
+
+	for (int i = 0; i < NumSamples; ++i)
+	{
+		Job.InputX[i] = inputGesture.Samples[i].X;
+		Job.InputY[i] = inputGesture.Samples[i].Y;
+		Job.InputZ[i] = inputGesture.Samples[i].Z;
+	}
+
+	Job.InputBounds = FBox(inputGesture.GestureSize.Min, inputGesture.GestureSize.Max);
+	Job.InputSize = inputGesture.GestureSize.GetSize();
+	Job.Scaler = GesturesDB->TargetGestureScale / Job.InputSize.GetMax();
+	Job.MirroringHand = MirroringHand;
+	Job.MaxSlope = maxSlope;
+	Job.OutGestureIndex = INDEX_NONE;
+	Job.OutCost = MAX_FLT;
 
-	for (int i = 1; i < seq1.Samples.Num() + 1/* - seq2.Minimum_Gesture_Length*/; i++)
+	TSharedPtr<FVRGestureRecognitionJob, ESPMode::ThreadSafe> JobRef = RecognitionJob;
+	RecognitionTask = FFunctionGraphTask::CreateAndDispatchWhenReady([JobRef]()
 	{
-		if (LookupTable[(i*ColumnCount) + seq2.Samples.Num()] < bestMatch)
-		bestMatch = LookupTable[(i*ColumnCount) + seq2.Samples.Num()];
+		JobRef->Run();
+	}, TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask);
+}
+
+void UVRGestureComponent::ConsumeAsyncRecognition()
+{
+	if (!RecognitionTask.IsValid() || !RecognitionTask->IsComplete())
+		return;
+
+	RecognitionTask = nullptr;
+
+	if (!RecognitionJob.IsValid())
+		return;
+
+	const FVRGestureRecognitionJob& Job = *RecognitionJob;
+
+	// Thrown out if the recording was cleared or the database swapped while it was running
+	if (Job.OutGestureIndex == INDEX_NONE ||
+		Job.RecordingSerial != RecordingSerial ||
+		Job.SourceDatabase.Get() != GesturesDB ||
+		!GesturesDB->Gestures.IsValidIndex(Job.OutGestureIndex))
+	{
+		return;
+	}
+
+	int OutGestureIndex = Job.OutGestureIndex;
+	FVector Size = Job.InputSize;
+
+	OnGestureDetected(GesturesDB->Gestures[OutGestureIndex].GestureType, GesturesDB->Gestures[OutGestureIndex].Name, OutGestureIndex, GesturesDB, Size);
+	OnGestureDetected_Bind.Broadcast(GesturesDB->Gestures[OutGestureIndex].GestureType, GesturesDB->Gestures[OutGestureIndex].Name, OutGestureIndex, GesturesDB, Size);
+	ClearRecording(); // Clear the recording out, we don't want to detect this gesture again with the same data
+	RecordingGestureDraw.Reset();
+}
+
+void UVRGestureComponent::AbandonAsyncRecognition()
+{
+	// The task holds its own reference to the job, let it finish on its own and start a fresh one next time
+	RecognitionTask = nullptr;
+	RecognitionJob.Reset();
+}
+
+void FVRGestureRecognitionJob::Run()
+{
+	OutGestureIndex = INDEX_NONE;
+	OutCost = MAX_FLT;
+
+	const int NumSamples = InputX.Num();
+	if (!BakedDatabase.IsValid() || NumSamples < 1)
+		return;
+
+	const FVRGestureBakedDatabase& Database = *BakedDatabase;
+
+	Candidates.Reset();
+
+	for (int i = 0; i < Database.Gestures.Num(); ++i)
+	{
+		const FVRGestureBakedDatabase::FBakedGesture& Gesture = Database.Gestures[i];
+
+		if (!Gesture.Settings.bEnabled || Gesture.SampleCount < 1 || NumSamples < Gesture.Settings.Minimum_Gesture_Length)
+			continue;
+
+		const float FinalScaler = Gesture.Settings.bEnableScaling ? Scaler : 1.f;
+		bool bMirrorGesture = (MirroringHand != EVRGestureMirrorMode::GES_NoMirror && MirroringHand != EVRGestureMirrorMode::GES_MirrorBoth && MirroringHand == Gesture.Settings.MirrorMode);
+
+		const float FirstThresholdSquared = FMath::Square(Gesture.Settings.firstThreshold);
+		const float FirstX = InputX[0] * FinalScaler - Database.SampleX[Gesture.SampleOffset];
+		const float FirstZ = InputZ[0] * FinalScaler - Database.SampleZ[Gesture.SampleOffset];
+		float FirstY = InputY[0] * FinalScaler - (bMirrorGesture ? Database.MirroredSampleY : Database.SampleY)[Gesture.SampleOffset];
+
+		if (FirstX * FirstX + FirstY * FirstY + FirstZ * FirstZ >= FirstThresholdSquared)
+		{
+			if (Gesture.Settings.MirrorMode != EVRGestureMirrorMode::GES_MirrorBoth)
+				continue;
+
+			bMirrorGesture = true;
+			FirstY = InputY[0] * FinalScaler - Database.MirroredSampleY[Gesture.SampleOffset];
+			if (FirstX * FirstX + FirstY * FirstY + FirstZ * FirstZ >= FirstThresholdSquared)
+				continue;
+		}
+
+		const float FullCost = FMath::Square(Gesture.Settings.FullThreshold) * Gesture.SampleCount;
+		const float LowerBound = GetLowerBound(Gesture, bMirrorGesture, FinalScaler, FullCost);
+		if (LowerBound >= FullCost)
+			continue;
+
+		Candidates.Add(FVRGestureMatchCandidate(i, bMirrorGesture, FinalScaler, LowerBound / Gesture.SampleCount));
+	}
+
+	// Same ordering and pruning as the game thread path
+	Candidates.Sort([](const FVRGestureMatchCandidate& A, const FVRGestureMatchCandidate& B)
+	{
+		return A.LowerBound < B.LowerBound;
+	});
+
+	for (const FVRGestureMatchCandidate& Candidate : Candidates)
+	{
+		if (Candidate.LowerBound >= OutCost)
+			break;
+
+		const FVRGestureBakedDatabase::FBakedGesture& Gesture = Database.Gestures[Candidate.GestureIndex];
+		const float FullThresholdSquared = FMath::Square(Gesture.Settings.FullThreshold);
+
+		float d = DTW(Gesture, Candidate.bMirrored, Candidate.Scaler, FMath::Min(OutCost, FullThresholdSquared) * Gesture.SampleCount) / Gesture.SampleCount;
+		if (d < OutCost && d < FullThresholdSquared)
+		{
+			OutCost = d;
+			OutGestureIndex = Candidate.GestureIndex;
+		}
+	}
+}
+
+float FVRGestureRecognitionJob::GetLowerBound(const FVRGestureBakedDatabase::FBakedGesture& Gesture, bool bMirrored, float InScaler, float AbandonCost)
+{
+	// Same bound as UVRGestureComponent::GetGestureLowerBound, run over the packed arrays
+	FBox Bounds(InputBounds.Min * InScaler, InputBounds.Max * InScaler);
+	if (bMirrored)
+	{
+		Bounds.Min.Y = -InputBounds.Max.Y * InScaler;
+		Bounds.Max.Y = -InputBounds.Min.Y * InScaler;
+	}
+
+	const FBox& Envelope = Gesture.Envelope;
+	FVector Gap = FVector::ZeroVector;
+	Gap.X = FMath::Max3(0.0, Envelope.Min.X - Bounds.Max.X, Bounds.Min.X - Envelope.Max.X);
+	Gap.Y = FMath::Max3(0.0, Envelope.Min.Y - Bounds.Max.Y, Bounds.Min.Y - Envelope.Max.Y);
+	Gap.Z = FMath::Max3(0.0, Envelope.Min.Z - Bounds.Max.Z, Bounds.Min.Z - Envelope.Max.Z);
+
+	float LowerBound = Gap.SizeSquared() * Gesture.SampleCount;
+	if (LowerBound >= AbandonCost)
+		return LowerBound;
+
+	// The bounds were mirrored instead of the gesture, so the un-mirrored samples are used here
+	const float* RESTRICT GX = BakedDatabase->SampleX.GetData() + Gesture.SampleOffset;
+	const float* RESTRICT GY = BakedDatabase->SampleY.GetData() + Gesture.SampleOffset;
+	const float* RESTRICT GZ = BakedDatabase->SampleZ.GetData() + Gesture.SampleOffset;
+
+	const float MinX = Bounds.Min.X, MaxX = Bounds.Max.X;
+	const float MinY = Bounds.Min.Y, MaxY = Bounds.Max.Y;
+	const float MinZ = Bounds.Min.Z, MaxZ = Bounds.Max.Z;
+
+	// Branchless so that it vectorizes, no early out inside of the loop
+	LowerBound = 0.f;
+	for (int j = 0; j < Gesture.SampleCount; ++j)
+	{
+		const float DX = FMath::Max(0.f, FMath::Max(MinX - GX[j], GX[j] - MaxX));
+		const float DY = FMath::Max(0.f, FMath::Max(MinY - GY[j], GY[j] - MaxY));
+		const float DZ = FMath::Max(0.f, FMath::Max(MinZ - GZ[j], GZ[j] - MaxZ));
+		LowerBound += DX * DX + DY * DY + DZ * DZ;
+	}
+
+	return LowerBound;
+}
+
+float FVRGestureRecognitionJob::DTW(const FVRGestureBakedDatabase::FBakedGesture& Gesture, bool bMirrored, float InScaler, float AbandonCost)
+{
+	// Same recurrence as UVRGestureComponent::dtw, but only the last two rows are kept
+	// and each rows sample distances are computed up front in one pass over the packed arrays.
+	const int GestureLength = Gesture.SampleCount;
+	const int ColumnCount = GestureLength + 1;
+	const int NumSamples = InputX.Num();
+
+	const float* RESTRICT GX = BakedDatabase->SampleX.GetData() + Gesture.SampleOffset;
+	const float* RESTRICT GY = (bMirrored ? BakedDatabase->MirroredSampleY : BakedDatabase->SampleY).GetData() + Gesture.SampleOffset;
+	const float* RESTRICT GZ = BakedDatabase->SampleZ.GetData() + Gesture.SampleOffset;
+
+	DistanceRow.SetNumUninitialized(GestureLength, false);
+	for (int k = 0; k < 2; ++k)
+	{
+		CostRows[k].SetNumUninitialized(ColumnCount, false);
+		SlopeIRows[k].SetNumUninitialized(ColumnCount, false);
+		SlopeJRows[k].SetNumUninitialized(ColumnCount, false);
+	}
+
+	// Row zero, only the anchor cell is reachable
+	int PrevRow = 0;
+	CostRows[PrevRow][0] = 0.f;
+	for (int j = 1; j < ColumnCount; ++j)
+	{
+		CostRows[PrevRow][j] = MAX_FLT;
+	}
+	FMemory::Memzero(SlopeIRows[PrevRow].GetData(), ColumnCount * sizeof(int));
+	FMemory::Memzero(SlopeJRows[PrevRow].GetData(), ColumnCount * sizeof(int));
+
+	float bestMatch = MAX_FLT;
+	float* RESTRICT Distances = DistanceRow.GetData();
+
+	for (int i = 1; i <= NumSamples; ++i)
+	{
+		const int CurRow = PrevRow ^ 1;
+
+		const float* Prev = CostRows[PrevRow].GetData();
+		const int* PrevSlopeJ = SlopeJRows[PrevRow].GetData();
+		float* Cur = CostRows[CurRow].GetData();
+		int* CurSlopeI = SlopeIRows[CurRow].GetData();
+		int* CurSlopeJ = SlopeJRows[CurRow].GetData();
+
+		const float X = InputX[i - 1] * InScaler;
+		const float Y = InputY[i - 1] * InScaler;
+		const float Z = InputZ[i - 1] * InScaler;
+
+		for (int j = 0; j < GestureLength; ++j)
+		{
+			const float DX = X - GX[j];
+			const float DY = Y - GY[j];
+			const float DZ = Z - GZ[j];
+			Distances[j] = DX * DX + DY * DY + DZ * DZ;
+		}
+
+		Cur[0] = MAX_FLT;
+		CurSlopeI[0] = 0;
+		CurSlopeJ[0] = 0;
+
+		float RowMin = MAX_FLT;
+
+		for (int j = 1; j < ColumnCount; ++j)
+		{
+			if (Cur[j - 1] < Prev[j - 1] && Cur[j - 1] < Prev[j] && CurSlopeI[j - 1] < MaxSlope)
+			{
+				Cur[j] = Distances[j - 1] + Cur[j - 1];
+				CurSlopeI[j] = CurSlopeJ[j - 1] + 1;
+				CurSlopeJ[j] = 0;
+			}
+			else if (Prev[j] < Prev[j - 1] && Prev[j] < Cur[j - 1] && PrevSlopeJ[j] < MaxSlope)
+			{
+				Cur[j] = Distances[j - 1] + Prev[j];
+				CurSlopeI[j] = 0;
+				CurSlopeJ[j] = PrevSlopeJ[j] + 1;
+			}
+			else
+			{
+				Cur[j] = Distances[j - 1] + Prev[j - 1];
+				CurSlopeI[j] = 0;
+				CurSlopeJ[j] = 0;
+			}
+
+			RowMin = FMath::Min(RowMin, Cur[j]);
+		}
+
+		bestMatch = FMath::Min(bestMatch, Cur[GestureLength]);
+
+		if (RowMin >= AbandonCost)
+			break;
+
+		PrevRow = CurRow;
 	}
 
 	return bestMatch;
 }
 
+void UVRGestureComponent::InvalidateGestureStreams()
+{
+	for (FVRGestureDTWStream& Stream : GestureStreams)
+	{
+		Stream.bNeedsRebuild = true;
+	}
+}
+
+void FVRGestureDTWStream::Init(int InGestureLength, bool bInMirrored, float InScaler, int InConsumedSamples)
+{
+	GestureLength = InGestureLength;
+	bMirrored = bInMirrored;
+	Scaler = InScaler;
+	ConsumedSamples = InConsumedSamples;
+	CurrentColumn = 0;
+	bNeedsRebuild = false;
+
+	const int ColumnCount = GestureLength + 1;
+
+	for (int i = 0; i < 2; ++i)
+	{
+		// Doesn't shrink, so re-inits keep the allocation
+		CostColumns[i].SetNumUninitialized(ColumnCount, false);
+		SlopeIColumns[i].SetNumUninitialized(ColumnCount, false);
+		SlopeJColumns[i].SetNumUninitialized(ColumnCount, false);
+		StartColumns[i].SetNumUninitialized(ColumnCount, false);
+	}
+
+	// Nothing has been matched yet, only the free start cell is reachable
+	CostColumns[0][0] = 0.f;
+	SlopeIColumns[0][0] = 0;
+	SlopeJColumns[0][0] = 0;
+	StartColumns[0][0] = ConsumedSamples;
+
+	for (int j = 1; j < ColumnCount; ++j)
+	{
+		CostColumns[0][j] = MAX_FLT;
+		SlopeIColumns[0][j] = 0;
+		SlopeJColumns[0][j] = 0;
+		StartColumns[0][j] = ConsumedSamples;
+	}
+}
+
+float FVRGestureDTWStream::GetMatchCost(int OldestValidSample) const
+{
+	if (bNeedsRebuild || GestureLength < 1 || StartColumns[CurrentColumn][GestureLength] < OldestValidSample)
+		return MAX_FLT;
+
+	return CostColumns[CurrentColumn][GestureLength];
+}
+
 void UVRGestureComponent::DrawDebugGesture(UObject* WorldContextObject, FTransform &StartTransform, FVRGesture GestureToDraw, FColor const& Color, bool bPersistentLines, uint8 DepthPriority, float LifeTime, float Thickness)
 {
 #if ENABLE_DRAW_DEBUG
@@ -579,6 +1123,89 @@ void UGesturesDatabase::RecalculateGestures(bool bScaleToDatabase)
 	{
 		Gestures[i].CalculateSizeOfGesture(bScaleToDatabase, TargetGestureScale);
 	}
+
+	MarkBakedGesturesDirty();
+	GetBakedGestures();
+}
+
+void UGesturesDatabase::MarkBakedGesturesDirty()
+{
+	BakedGestures.Reset();
+	++GestureEditSerial;
+
+	// Samples may have been edited in place with the same count
+	for (FVRGesture& Gesture : Gestures)
+	{
+		Gesture.InvalidateEnvelope();
+	}
+}
+
+TSharedPtr<const FVRGestureBakedDatabase, ESPMode::ThreadSafe> UGesturesDatabase::GetBakedGestures()
+{
+	if (!BakedGestures.IsValid() || BakedGestures->IsOutOfDate(Gestures, GestureEditSerial))
+	{
+		TSharedPtr<FVRGestureBakedDatabase, ESPMode::ThreadSafe> NewBake = MakeShared<FVRGestureBakedDatabase, ESPMode::ThreadSafe>();
+		NewBake->Bake(Gestures, GestureEditSerial);
+		BakedGestures = NewBake;
+	}
+
+	return BakedGestures;
+}
+
+#if WITH_EDITOR
+void UGesturesDatabase::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	MarkBakedGesturesDirty();
+}
+#endif
+
+void FVRGestureBakedDatabase::Bake(const TArray<FVRGesture>& SourceGestures, uint32 EditSerial)
+{
+	SourceEditSerial = EditSerial;
+
+	int TotalSamples = 0;
+	for (const FVRGesture& Gesture : SourceGestures)
+	{
+		TotalSamples += Gesture.Samples.Num();
+	}
+
+	Gestures.Reset(SourceGestures.Num());
+	SampleX.Reset(TotalSamples);
+	SampleY.Reset(TotalSamples);
+	SampleZ.Reset(TotalSamples);
+	MirroredSampleY.Reset(TotalSamples);
+
+	for (const FVRGesture& Gesture : SourceGestures)
+	{
+		FBakedGesture& Baked = Gestures.AddDefaulted_GetRef();
+		Baked.SampleOffset = SampleX.Num();
+		Baked.SampleCount = Gesture.Samples.Num();
+		Baked.Envelope = FBox(Gesture.Samples);
+		Baked.Settings = Gesture.GestureSettings;
+
+		for (const FVector& Sample : Gesture.Samples)
+		{
+			SampleX.Add(Sample.X);
+			SampleY.Add(Sample.Y);
+			SampleZ.Add(Sample.Z);
+			MirroredSampleY.Add(-Sample.Y);
+		}
+	}
+}
+
+bool FVRGestureBakedDatabase::IsOutOfDate(const TArray<FVRGesture>& SourceGestures, uint32 EditSerial) const
+{
+	if (EditSerial != SourceEditSerial || SourceGestures.Num() != Gestures.Num())
+		return true;
+
+	for (int i = 0; i < Gestures.Num(); ++i)
+	{
+		if (SourceGestures[i].Samples.Num() != Gestures[i].SampleCount)
+			return true;
+	}
+
+	return false;
 }
 
 bool UGesturesDatabase::ImportSplineAsGesture(USplineComponent * HostSplineComponent, FString GestureName, bool bKeepSplineCurves, float SegmentLen, bool bScaleToDatabase)
@@ -670,6 +1297,7 @@ bool UGesturesDatabase::ImportSplineAsGesture(USplineComponent * HostSplineCompo
 
 	NewGesture.CalculateSizeOfGesture(bScaleToDatabase, this->TargetGestureScale);
 	Gestures.Add(NewGesture);
+	MarkBakedGesturesDirty();
 	return true;
 }
 
@@ -738,6 +1366,7 @@ FVRGestureSplineDraw::~FVRGestureSplineDraw()
 void UVRGestureComponent::BeginDestroy()
 {
 	Super::BeginDestroy();
+	AbandonAsyncRecognition();
 	RecordingGestureDraw.Clear();
 	if (TickGestureTimer_Handle.IsValid())
 	{
@@ -768,6 +1397,7 @@ FVRGesture UVRGestureComponent::EndRecording()
 
 	this->SetComponentTickEnabled(false);
 	CurrentState = EVRGestureState::GES_None;
+	AbandonAsyncRecognition();
 
 	// Reset the recording gesture
 	RecordingGestureDraw.Reset();
@@ -778,6 +1408,8 @@ FVRGesture UVRGestureComponent::EndRecording()
 void UVRGestureComponent::ClearRecording()
 {
 	GestureLog.Samples.Reset(RecordingBufferSize);
+	RecordingSerial++;
+	InvalidateGestureStreams();
 }
 
 void UVRGestureComponent::SaveRecording(FVRGesture &Recording, FString RecordingName, bool bScaleRecordingToDatabase)
@@ -787,5 +1419,6 @@ void UVRGestureComponent::SaveRecording(FVRGesture &Recording, FString Recording
 		Recording.CalculateSizeOfGesture(bScaleRecordingToDatabase, GesturesDB->TargetGestureScale);
 		Recording.Name = RecordingName;
 		GesturesDB->Gestures.Add(Recording);
+		GesturesDB->MarkBakedGesturesDirty();
 	}
 }
@@ -31,6 +31,20 @@ UVRGlobalSettings::UVRGlobalSettings(const FObjectInitializer& ObjectInitializer
 
 		bUseCollisionModificationForCollisionIgnore = false;
 		CollisionIgnoreSubsystemUpdateRate = 1.f;
+		bUseEventDrivenCollisionIgnoreChecks = false;
+
+		bSpreadBucketUpdatesOverPeriod = false;
+		BucketUpdateBudgetMS = 0.f;
+
+		bBatchGripSweepsInEndPhysics = false;
+
+		bCacheGripInterfaceValues = false;
+		bUseBatchedGripTick = false;
+		BatchedGripTickParallelThreshold = 64;
+
+		bUseBatchedServerMoves = false;
+		BatchedServerMoveTimeBudgetMS = 0.f;
+		BatchedServerMoveMaxDeferredFrames = 2;
 
 		bUseChaosTranslationScalers = false;
 		bSetEngineChaosScalers = false;
@@ -65,6 +65,29 @@ enum class EVRMoveActionDataReq : uint8
 	VRMOVEACTIONDATA_LOC_AND_ROT = 0x03
 };
 
+// Precision of the roomscale delta (LFDiff) in delta compressed move data
+UENUM(Blueprintable)
+enum class EVRMoveDataLFDiffQuantization : uint8
+{
+	// Four decimals when not retaining roomscale, otherwise two, the same as the regular move data
+	MatchRoomscaleMode = 0,
+	RoundOneDecimal = 1,
+	RoundTwoDecimals = 2,
+	RoundFourDecimals = 3
+};
+
+// Smoothing quality that a simulated proxy is running at
+UENUM(Blueprintable)
+enum class EVRSimulatedProxyLOD : uint8
+{
+	// Simulated and smoothed every frame
+	Full = 0,
+	// Simulated and smoothed at the medium update rate
+	Medium = 1,
+	// Simulated at the far update rate, corrections are snapped to instead of smoothed
+	Far = 2
+};
+
 
 
 USTRUCT()
@@ -596,6 +619,15 @@ public:
 	FRotator VRCapsuleRotation;
 	FVRConditionalMoveRep ConditionalValues;
 
+	// Total length of the roomscale movement merged into this move, 0 if it was never combined
+	float RoomscalePathLength;
+
+	// Combined moves only keep the summed LFDiff, so the path is tracked separately
+	FORCEINLINE float GetRoomscalePathLength() const
+	{
+		return FMath::Max(RoomscalePathLength, LFDiff.Size2D());
+	}
+
 	void Clear();
 	virtual void SetInitialPosition(ACharacter* C);
 	virtual void PrepMoveFor(ACharacter* Character) override;
@@ -637,11 +669,18 @@ public:
 	EVRConjoinedMovementModes ReplicatedMovementMode;
 	FVRConditionalMoveRep ConditionalMoveReps;
 
+	// Move that this one is delta compressed against, the pending and old moves are serialized after the new move
+	// in the same container so they point to it, the new move is written against the defaults
+	const FVRCharacterNetworkMoveData* DeltaBaseMoveData;
+
 	FVRCharacterNetworkMoveData();
 
 	virtual ~FVRCharacterNetworkMoveData();
 	virtual void ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType) override;
 	virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType) override;
+
+	// Alternate serializer used when bUseDeltaCompressedMoveData is on, only writes the fields that differ from DeltaBaseMoveData
+	bool SerializeDeltaCompressed(UVRBaseCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap);
 };
 
 struct VREXPANSIONPLUGIN_API FVRCharacterNetworkMoveDataContainer : public FCharacterNetworkMoveDataContainer
@@ -656,6 +695,9 @@ public:
 		NewMoveData = &VRBaseDefaultMoveData[0];
 		PendingMoveData = &VRBaseDefaultMoveData[1];
 		OldMoveData = &VRBaseDefaultMoveData[2];
+
+		VRBaseDefaultMoveData[1].DeltaBaseMoveData = &VRBaseDefaultMoveData[0];
+		VRBaseDefaultMoveData[2].DeltaBaseMoveData = &VRBaseDefaultMoveData[0];
 	}
 
 	virtual ~FVRCharacterNetworkMoveDataContainer()
@@ -10,10 +10,13 @@
 #include "MotionControllerComponent.h"
 #include "VRGripInterface.h"
 #include "GripScripts/VRGripScriptBase.h"
+#include <atomic>
 #include "GripMotionControllerComponent.generated.h"
 
 class AVRBaseCharacter;
 class AVRCharacter;
+class UGripTickSubsystem;
+struct FGripTransformBatch;
 struct FXRDeviceId;
 
 /**
@@ -92,6 +95,38 @@ public:
 	/** Generates a LateUpdatePrimitiveInfo for the given component if it has a SceneProxy and appends it to the current LateUpdatePrimitives array */
 	void CacheSceneInfo(USceneComponent* Component);
 
+	// A component in a cached late update hierarchy, along with what it was attached to when cached
+	struct FLateUpdateCachedComponent
+	{
+		TWeakObjectPtr<USceneComponent> Component;
+		const USceneComponent* AttachParent;
+		int32 NumAttachChildren;
+	};
+
+	// The flattened hierarchy under a late update root, only re-walked when something in it is attached or detached
+	struct FLateUpdateHierarchyCache
+	{
+		TArray<FLateUpdateCachedComponent> Components;
+		bool bUsedThisFrame = false;
+	};
+
+	// Keyed by the root component of the hierarchy (the controller, additional components, and gripped roots)
+	// Entries that aren't used in a Setup call are dropped so released grips don't linger.
+	TMap<const USceneComponent*, FLateUpdateHierarchyCache> HierarchyCache;
+
+	// Re-usable scratch arrays to keep the per frame gather allocation free
+	TArray<USceneComponent*> GatherChildrenScratch;
+	TArray<UVRGripScriptBase*> GatherGripScriptsScratch;
+
+	bool IsHierarchyCacheValid(const FLateUpdateHierarchyCache& Cache) const;
+	void RebuildHierarchyCache(USceneComponent* ParentComponent, FLateUpdateHierarchyCache& Cache);
+
+	struct FLateUpdatePrimitiveInfo
+	{
+		FPrimitiveSceneInfo* SceneInfo;
+		int32 Index;
+	};
+
 	struct FLateUpdateState
 	{
 		FLateUpdateState()
@@ -102,8 +137,8 @@ public:
 
 		/** Parent world transform used to reconstruct new world transforms for late update scene proxies */
 		FTransform ParentToWorld;
-		/** Primitives that need late update before rendering */
-		TMap<FPrimitiveSceneInfo*, int32> Primitives;
+		/** Primitives that need late update before rendering, sorted by scene info and unique */
+		TArray<FLateUpdatePrimitiveInfo> Primitives;
 		/** Late Update Info Stale, if this is found true do not late update */
 		bool bSkip;
 		/** Frame tracking number - used to flag if the game and render threads get badly out of sync */
@@ -241,6 +276,15 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GripMotionController|Advanced")
 		bool bConstrainToPivot;
 
+	// How many of the kinematic actors that physics grips constrain to are kept around after a drop to be re-used on the next grip
+	// Saves creating and destroying them in the physics scene when objects are quickly dropped and re-gripped, 0 disables the pool
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GripMotionController|Advanced", meta = (ClampMin = "0", UIMin = "0"))
+		int32 PhysicsHandlePoolSize;
+
+	// If true the physics handle pool is filled on BeginPlay so that even the first physics grips don't create kinematic actors
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GripMotionController|Advanced")
+		bool bPrewarmPhysicsHandlePool;
+
 	UPROPERTY()
 		TObjectPtr<AVRCharacter> AttachChar;
 	void UpdateTracking(float DeltaTime);
@@ -334,9 +378,10 @@ protected:
 	
 	void OnModularFeatureUnregistered(const FName& Type, class IModularFeature* ModularFeature);
 
-	IMotionController* GripPolledMotionController_GameThread;
-	IMotionController* GripPolledMotionController_RenderThread;
-	FCriticalSection GripPolledMotionControllerMutex;
+	// The game thread publishes the controller it polled and the render thread picks it up at the start of the late update.
+	// Single pointer handoff so neither thread has to lock, unregistering a controller flushes the render thread instead.
+	std::atomic<IMotionController*> GripPolledMotionController_GameThread{ nullptr };
+	IMotionController* GripPolledMotionController_RenderThread = nullptr;
 
 	// Late update control variables (should likely struct these soon)
 	struct FRenderTrackingParams
@@ -363,6 +408,15 @@ protected:
 
 public:
 
+	// Returns how many late update frames were skipped because the component was being torn down at the time
+	// and how many found no polled controller from the game thread, for tracking down late update jitter
+	// Counts are kept on the view extension, so they reset whenever it is re-created
+	UFUNCTION(BlueprintPure, Category = "GripMotionController|Advanced")
+		void GetLateUpdateHandoffStats(int32& FramesSkippedForTeardown, int32& FramesWithoutController) const;
+
+	UFUNCTION(BlueprintCallable, Category = "GripMotionController|Advanced")
+		void ResetLateUpdateHandoffStats();
+
 	// Called when a controller first gets a valid tracked frame
 	UPROPERTY(BlueprintAssignable, Category = "GripMotionController")
 		FVRGripControllerOnTrackingEventSignature OnTrackingChanged;
@@ -782,6 +836,7 @@ public:
 					LocalTransactionBuffer[i].ValueCache.CachedGripID = LocalTransactionBuffer[i].GripID;
 
 					int32 Index = LocallyGrippedObjects.Add(LocalTransactionBuffer[i]);
+					MarkGripIndexDirty();
 
 					if (Index != INDEX_NONE)
 					{
@@ -807,6 +862,9 @@ public:
 		// Check for removed gripped actors
 		// This might actually be better left as an RPC multicast
 
+		// The array was replaced by replication, the index needs to be rebuilt
+		MarkGripIndexDirty();
+
 		for (int i = GrippedObjects.Num() - 1; i >= 0; --i)
 		{
 			HandleGripReplication(GrippedObjects[i], OriginalArrayState.FindByKey(GrippedObjects[i].GripID));
@@ -816,6 +874,8 @@ public:
 	UFUNCTION()
 	virtual void OnRep_LocallyGrippedObjects(TArray<FBPActorGripInformation> OriginalArrayState)
 	{
+		MarkGripIndexDirty();
+
 		for (int i = LocallyGrippedObjects.Num() - 1; i >= 0; --i)
 		{
 			HandleGripReplication(LocallyGrippedObjects[i], OriginalArrayState.FindByKey(LocallyGrippedObjects[i].GripID));
@@ -872,10 +932,134 @@ public:
 	UPROPERTY(EditAnywhere, Category = "GripMotionController|Networking|Smoothing", meta = (editcondition = "bUseExponentialSmoothing"))
 		float NetworkNoSmoothUpdateDistance = 100.f;
 
+	// If true then replicated transforms are buffered and played back SnapshotPlayoutDelay behind the newest one with hermite interpolation
+	// Overrides the other smoothing modes, absorbs variable latency at the cost of the added delay
+	// The owning client stamps its sends with its own time when this is on so playback follows when they were captured, keep it the same on every machine
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GripMotionController|Networking|Smoothing", meta = (editcondition = "bSmoothReplicatedMotion"))
+		bool bUseSnapshotInterpolation = false;
+
+	// How far behind the newest snapshot to play back, should cover the update interval plus the expected jitter
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GripMotionController|Networking|Smoothing", meta = (editcondition = "bUseSnapshotInterpolation", ClampMin = "0", UIMin = "0"))
+		float SnapshotPlayoutDelay = 0.05f;
+
+	// Max time to extrapolate past the newest snapshot when the buffer runs dry
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GripMotionController|Networking|Smoothing", meta = (editcondition = "bUseSnapshotInterpolation", ClampMin = "0", UIMin = "0"))
+		float MaxSnapshotExtrapolationTime = 0.05f;
+
+	FVRSnapshotInterpolationBuffer SnapshotBuffer;
+
+	// Returns the playback stats of the snapshot buffer, use this to tune the playout delay
+	UFUNCTION(BlueprintPure, Category = "GripMotionController|Networking")
+		FBPVRSnapshotBufferStats GetSnapshotBufferStats() const;
+
+	UFUNCTION(BlueprintCallable, Category = "GripMotionController|Networking")
+		void ResetSnapshotBufferStats();
+
 	// Whether to replicate even if no tracking (FPS or test characters)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category = "GripMotionController|Networking")
 		bool bReplicateWithoutTracking;
 
+	// If true the owning client sends its transform with smallest three rotations and positions delta compressed against the last
+	// keyframe that the server acked, and scales the send rate between AdaptiveMinNetUpdateRate and ControllerNetUpdateRate by how fast the hand is moving
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GripMotionController|Networking|Adaptive")
+		bool bUseAdaptiveControllerReplication;
+
+	// The send rate used when the hand is still
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GripMotionController|Networking|Adaptive", meta = (editcondition = "bUseAdaptiveControllerReplication", ClampMin = "1", UIMin = "1"))
+		float AdaptiveMinNetUpdateRate;
+
+	// Linear speed (cm/s) at or above which the full ControllerNetUpdateRate is used
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GripMotionController|Networking|Adaptive", meta = (editcondition = "bUseAdaptiveControllerReplication", ClampMin = "0.01", UIMin = "0.01"))
+		float AdaptiveFullRateLinearSpeed;
+
+	// Angular speed (deg/s) at or above which the full ControllerNetUpdateRate is used
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GripMotionController|Networking|Adaptive", meta = (editcondition = "bUseAdaptiveControllerReplication", ClampMin = "0.01", UIMin = "0.01"))
+		float AdaptiveFullRateAngularSpeed;
+
+	// Positions further than this from the acked keyframe get a new keyframe instead of a delta
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GripMotionController|Networking|Adaptive", meta = (editcondition = "bUseAdaptiveControllerReplication", ClampMin = "1", UIMin = "1"))
+		float AdaptiveMaxDeltaDistance;
+
+	// If true remotes keep moving the hand along its last replicated velocity between updates, for up to MaxReplicatedExtrapolationTime
+	// Only used with exponential smoothing
+	UPROPERTY(EditAnywhere, Category = "GripMotionController|Networking|Smoothing", meta = (editcondition = "bUseExponentialSmoothing"))
+		bool bExtrapolateReplicatedMotion;
+
+	UPROPERTY(EditAnywhere, Category = "GripMotionController|Networking|Smoothing", meta = (editcondition = "bExtrapolateReplicatedMotion", ClampMin = "0", UIMin = "0"))
+		float MaxReplicatedExtrapolationTime;
+
+	// Sender side state for the adaptive replication
+	struct FAdaptiveControllerRepState
+	{
+		static const int32 NumKeyframes = 16;
+
+		// Keyframes we have sent, by ID, with when they were sent
+		FVector SentKeyframes[NumKeyframes];
+		float SentKeyframeTimes[NumKeyframes];
+		uint8 NextKeyframeID;
+		float LastKeyframeSendTime;
+
+		bool bHasAckedKeyframe;
+		uint8 AckedKeyframeID;
+
+		FVector LastSampleLocation;
+		FRotator LastSampleRotation;
+		bool bHasSample;
+
+		// Receiver side, keyframes from the owning client by ID
+		FVector ReceivedKeyframes[NumKeyframes];
+		uint16 ReceivedKeyframeMask;
+		uint8 LastReceivedKeyframeID;
+
+		FAdaptiveControllerRepState()
+		{
+			Reset();
+		}
+
+		void Reset()
+		{
+			for (int32 i = 0; i < NumKeyframes; ++i)
+			{
+				SentKeyframes[i] = FVector::ZeroVector;
+				SentKeyframeTimes[i] = -1.0f;
+				ReceivedKeyframes[i] = FVector::ZeroVector;
+			}
+
+			NextKeyframeID = 0;
+			LastKeyframeSendTime = -1.0f;
+			bHasAckedKeyframe = false;
+			AckedKeyframeID = 0;
+			LastSampleLocation = FVector::ZeroVector;
+			LastSampleRotation = FRotator::ZeroRotator;
+			bHasSample = false;
+			ReceivedKeyframeMask = 0;
+			LastReceivedKeyframeID = 0xFF;
+		}
+	};
+
+	FAdaptiveControllerRepState AdaptiveRepState;
+
+	// Receiver side velocity for extrapolation
+	FVector ReplicatedLinearVelocity;
+	FVector ReplicatedAngularVelocity; // Axis * rad/s
+	float LastReplicatedTransformTime;
+	FVector LastReplicatedPosition;
+	FQuat LastReplicatedRotation;
+
+	// Returns the send rate for this frame based on how fast the hand is moving
+	float GetAdaptiveControllerNetUpdateRate(const FVector& RelLoc, const FRotator& RelRot, float DeltaTime);
+
+	// Fills out the adaptive encoding of ReplicatedControllerTransform to send
+	void BuildAdaptiveControllerTransform(FBPVRComponentPosRep& OutTransform);
+
+	// Server side, turns a delta back into an absolute position and stores / acks keyframes
+	// Returns false if the delta is against a keyframe we don't have
+	bool ResolveAdaptiveControllerTransform(FBPVRComponentPosRep& InOutTransform);
+
+	// Server telling the owning client that it has a keyframe, deltas can be sent against it from then on
+	UFUNCTION(Unreliable, Client)
+	void Client_AckControllerKeyframe(uint8 KeyframeID);
+
 	// I'm sending it unreliable because it is being resent pretty often
 	UFUNCTION(Unreliable, Server, WithValidation)
 	void Server_SendControllerTransform(FBPVRComponentPosRep NewTransform);
@@ -884,6 +1068,9 @@ public:
 	typedef void (AVRBaseCharacter::*VRBaseCharTransformRPC_Pointer)(FBPVRComponentPosRep NewTransform);
 	VRBaseCharTransformRPC_Pointer OverrideSendTransform;
 
+	// Set by the owning character when it sends our transform in its coalesced pose, we only keep it current then
+	bool bCoalesceTransformSend;
+
 	// Need this as I can't think of another way for an actor component to make sure it isn't on the server
 	inline bool IsLocallyControlled() const
 	{
@@ -1106,6 +1293,34 @@ public:
 	// Gets a grip by its grip ID *NOTE*: Grip IDs are only unique to their controller, do NOT use them as cross controller identifiers
 	FBPActorGripInformation * GetGripPtrByID(uint8 IDToLookForGrip);
 
+	// Index of the grip arrays by grip ID and by gripped object so that lookups don't scan the arrays
+	// It is rebuilt lazily on the next lookup after being marked dirty, anything that adds, removes or replaces
+	// entries in GrippedObjects / LocallyGrippedObjects needs to call MarkGripIndexDirty()
+	struct FGripIndexEntry
+	{
+		bool bIsLocalGrip;
+		int32 Slot;
+	};
+
+	TMap<uint8, FGripIndexEntry> GripIDIndex;
+	TMap<const UObject*, FGripIndexEntry> GripObjectIndex;
+	bool bGripIndexDirty;
+
+	// Same thing for the physics handles, keyed by grip ID
+	TMap<uint8, int32> PhysicsGripIndex;
+	bool bPhysicsGripIndexDirty;
+
+	FORCEINLINE void MarkGripIndexDirty() { bGripIndexDirty = true; }
+	FORCEINLINE void MarkPhysicsGripIndexDirty() { bPhysicsGripIndexDirty = true; }
+	void RebuildGripIndex();
+	void RebuildPhysicsGripIndex();
+	int32 FindPhysicsGripIndex(uint8 GripID);
+	FBPActorGripInformation* ResolveGripIndexEntry(const FGripIndexEntry& Entry);
+
+	// Indexed lookups, searches GrippedObjects first and then LocallyGrippedObjects like the old FindByKey pairs did
+	FBPActorGripInformation* FindGripByID(uint8 GripID);
+	FBPActorGripInformation* FindGripByObject(const UObject* Object);
+
 	// Get the physics velocities of a grip
 	UFUNCTION(BlueprintPure, Category = "GripMotionController")
 		void GetPhysicsVelocities(const FBPActorGripInformation &Grip, FVector &AngularVelocity, FVector &LinearVelocity);
@@ -1236,6 +1451,34 @@ public:
 	// Splitting logic into separate function
 	void HandleGripArray(TArray<FBPActorGripInformation> &GrippedObjectsArray, const FTransform & ParentTransform, float DeltaTime, bool bReplicatedArray = false);
 
+	// Resolves the interface flags, break distance and grip scripts for a grip and stores them on its value cache
+	// so that the tick doesn't have to query the interface every frame.
+	void CacheGripInterfaceValues(FBPActorGripInformation& Grip, UPrimitiveComponent* root, AActor* actor);
+
+	// Re-usable list for the cached grip scripts of the grip currently being ticked, avoids an allocation per grip per frame
+	TArray<UVRGripScriptBase*> TickGripScripts;
+
+	// Call this when a gripped objects interface settings (break distance, grip scripts) change at runtime
+	// With bCacheGripInterfaceValues the interface values are cached at grip time, this invalidates them so they are re-queried on the next tick
+	// Passing in no object will refresh every grip on this controller
+	UFUNCTION(BlueprintCallable, Category = "GripMotionController")
+		void NotifyGripSettingsChanged(UObject* GrippedObject = nullptr);
+
+	// Set when bUseBatchedGripTick is enabled, the subsystem runs TickGrip for us once every controller has updated its tracking
+	TWeakObjectPtr<UGripTickSubsystem> BatchedGripTickSubsystem;
+	bool bPendingBatchedGripTick;
+	float PendingBatchedGripDeltaTime;
+
+	// Adds the grips that only need the default grip transform this frame to the batch
+	void GatherBatchedGripTransforms(FGripTransformBatch& Batch);
+
+	// If the grip transform is nothing more than the default scripts relative * addition * parent transform
+	// No grip scripts, secondary grips or lerping, so it can be solved without any script or interface calls
+	bool CanBatchGripTransform(const FBPActorGripInformation& Grip) const;
+
+	// Makes the gripped objects tick function wait on the batched grip tick as well as on us
+	void SetBatchedGripTickPrerequisite(FTickFunction& GrippedTickFunction, bool bAdd);
+
 	// Gets the world transform of a grip, modified by secondary grips, returns if it has a valid transform, if not then this tick will be skipped for the object
 	bool GetGripWorldTransform(TArray<UVRGripScriptBase*>& GripScripts, float DeltaTime,FTransform & WorldTransform, const FTransform &ParentTransform, FBPActorGripInformation &Grip, AActor * actor, UPrimitiveComponent * root, bool bRootHasInterface, bool bActorHasInterface, bool bIsForTeleport, bool &bForceADrop);
 
@@ -1359,6 +1602,45 @@ public:
 	bool bUseWithoutTracking;
 
 	bool CheckComponentWithSweep(UPrimitiveComponent * ComponentToCheck, FVector Move, FRotator newOrientation, bool bSkipSimulatingComponents/*, bool & bHadBlockingHitOut*/);
+
+	// Same as above but sweeps from a given start location instead of the components current one
+	bool CheckComponentWithSweepFrom(UPrimitiveComponent* ComponentToCheck, const FVector& Start, FVector Move, FRotator newOrientation, bool bSkipSimulatingComponents);
+
+	// A grip sweep queued during the grip tick and resolved in the end physics tick when bBatchGripSweepsInEndPhysics is on
+	struct FGripSweepRequest
+	{
+		TWeakObjectPtr<UPrimitiveComponent> Component;
+		FVector Start;
+		FVector End;
+		FQuat Rotation;
+		FQuat FallbackRotation;
+		uint8 GripID;
+		bool bIsHybridSweep;
+		bool bCheckFallbackRotation;
+	};
+
+	// Sweeps queued this frame, processed together in EndPhysicsTickComponent
+	TArray<FGripSweepRequest> PendingGripSweeps;
+	TArray<FGripSweepRequest> ProcessingGripSweeps;
+
+	// Re-used buffers for the batched sweeps
+	TArray<FHitResult> GripSweepHits;
+	TArray<USceneComponent*> GripSweepChildren;
+
+	// Queues a sweep for the batch and makes sure that the end physics tick is running to resolve it
+	void QueueGripSweep(uint8 GripID, UPrimitiveComponent* Component, const FVector& Start, const FVector& End, const FQuat& Rotation, bool bIsHybridSweep, bool bCheckFallbackRotation = false, const FQuat& FallbackRotation = FQuat::Identity);
+
+	// Runs all of the queued grip sweeps and stores their results on the grips for the next tick
+	void ProcessGripSweepBatch();
+
+	// True if any held grip resolves its sweeps in the batch, the end physics tick stays registered while one does
+	bool HasBatchedSweepGrips() const;
+
+	// Fills in the query params that hybrid with sweep grips use
+	void InitHybridSweepParams(FComponentQueryParams& Params, AActor* actor, UPrimitiveComponent* root);
+
+	// Returns true if any blocking hit in the list isn't being ignored by the collision ignore subsystem
+	bool HasUnignoredBlockingHit(UPrimitiveComponent* root, const TArray<FHitResult>& Hits);
 	
 	// For physics handle operations
 	void OnGripMassUpdated(FBodyInstance* GripBodyInstance);
@@ -1376,6 +1658,18 @@ public:
 	bool DestroyPhysicsHandle(FBPActorPhysicsHandleInformation * HandleInfo);
 	bool PausePhysicsHandle(FBPActorPhysicsHandleInformation* HandleInfo);
 	bool UnPausePhysicsHandle(FBPActorGripInformation& GripInfo, FBPActorPhysicsHandleInformation* HandleInfo);
+
+	// Kinematic actors from dropped physics grips, parked in the scene until the next grip takes one
+	TArray<FPhysicsActorHandle> PhysicsHandleAnchorPool;
+
+	// Scene must be write locked for these
+	FPhysicsActorHandle CreatePhysicsHandleAnchor(FPhysScene* Scene, const FTransform& KinPose);
+	FPhysicsActorHandle AcquirePhysicsHandleAnchor(FPhysScene* Scene, const FTransform& KinPose);
+
+	// Returns the anchor to the pool if there is room in it, otherwise releases it from the scene, nulls out the passed in handle
+	void ReleasePhysicsHandleAnchor(FPhysicsActorHandle& Anchor);
+	void PrewarmPhysicsHandlePool();
+	void EmptyPhysicsHandlePool();
 	
 	// Gets the advanced physics handle settings
 	UFUNCTION(BlueprintCallable, Category = "GripMotionController|Custom", meta = (DisplayName = "GetPhysicsHandleSettings"))
@@ -1464,7 +1758,16 @@ private:
 		/** Motion controller component associated with this view extension */
 		UGripMotionControllerComponent* MotionControllerComponent;
 
+		/** This is to prevent destruction of the motion controller component while it is
+		in the middle of being accessed by the render thread */
+		FCriticalSection CritSect;
+
 		FExpandedLateUpdateManager LateUpdate;
+
+		// Late update handoff counters, written from the render thread
+		// Kept here instead of on the component as the component can't be touched if we failed to get the lock
+		std::atomic<int32> FramesSkippedForTeardown{ 0 };
+		std::atomic<int32> FramesWithoutController{ 0 };
 	};
 	TSharedPtr< FGripViewExtension, ESPMode::ThreadSafe > GripViewExtension;
 
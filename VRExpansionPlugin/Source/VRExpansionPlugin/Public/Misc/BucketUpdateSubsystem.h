@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Tickable.h"
+#include "UObject/ObjectKey.h"
 #include "BucketUpdateSubsystem.generated.h"
 //#include "GrippablePhysicsReplication.generated.h"
 
@@ -15,11 +16,100 @@
 DECLARE_DELEGATE_RetVal(bool, FBucketUpdateTickSignature);
 DECLARE_DYNAMIC_DELEGATE(FDynamicBucketUpdateTickSignature);
 
+// Called with a contiguous run of the objects registered to a batch
+typedef TFunction<void(TArrayView<UObject* const>)> FBucketUpdateBatchFunction;
+
+enum class EUpdateBucketCallbackType : uint8
+{
+	// UFUNCTION by name
+	Function,
+	// Dynamic delegate
+	Event,
+	// Native member function, named by the caller
+	Native,
+	// Object in a named batch
+	Batch
+};
+
+// Identifies a bucket callback for the container index, each callback type is kept separate
+struct VREXPANSIONPLUGIN_API FUpdateBucketKey
+{
+	TObjectKey<UObject> Object;
+	FName FunctionName;
+	EUpdateBucketCallbackType Type;
+
+	FUpdateBucketKey() :
+		FunctionName(NAME_None),
+		Type(EUpdateBucketCallbackType::Function)
+	{}
+
+	FUpdateBucketKey(const UObject* InObject, FName InFunctionName, EUpdateBucketCallbackType InType = EUpdateBucketCallbackType::Function) :
+		Object(InObject),
+		FunctionName(InFunctionName),
+		Type(InType)
+	{}
+
+	FUpdateBucketKey(const TObjectKey<UObject>& InObject, FName InFunctionName, EUpdateBucketCallbackType InType) :
+		Object(InObject),
+		FunctionName(InFunctionName),
+		Type(InType)
+	{}
+
+	FUpdateBucketKey(const FDynamicBucketUpdateTickSignature& InEvent) :
+		Object(InEvent.GetUObject()),
+		FunctionName(InEvent.GetFunctionName()),
+		Type(EUpdateBucketCallbackType::Event)
+	{}
+
+	FORCEINLINE bool operator==(const FUpdateBucketKey& Other) const
+	{
+		return Object == Other.Object && FunctionName == Other.FunctionName && Type == Other.Type;
+	}
+
+	friend uint32 GetTypeHash(const FUpdateBucketKey& InKey)
+	{
+		return HashCombine(HashCombine(GetTypeHash(InKey.Object), GetTypeHash(InKey.FunctionName)), (uint32)InKey.Type);
+	}
+};
+
+// A set of objects that share one native function, the bucket hands it contiguous runs of them instead of one call each
+struct VREXPANSIONPLUGIN_API FUpdateBucketBatch
+{
+	FBucketUpdateBatchFunction BatchFunction;
+
+	// Class the batch function casts its objects to, every object in the batch has to be one
+	const UClass* ObjectClass;
+	TArray<TObjectKey<UObject>> Objects;
+
+	// Slot of each object in the array above
+	TMap<TObjectKey<UObject>, int32> ObjectSlots;
+
+	// Same spreading as the bucket callbacks, but per object
+	float CallbackCredit;
+	int32 NextObjectIndex;
+
+	void AddObject(UObject* InObject);
+
+	// Swap removes, the last object in the batch takes over the slot
+	bool RemoveObject(const TObjectKey<UObject>& InObject);
+	void RemoveObjectAt(int32 Index);
+
+	// Objects that are no longer valid get removed and added to OutRemovedCallbacks
+	void Update(float DeltaTime, float UpdateRate, bool bSpreadOverPeriod, FName BatchName, TArray<FUpdateBucketKey>& OutRemovedCallbacks);
+
+	FUpdateBucketBatch() :
+		ObjectClass(nullptr),
+		CallbackCredit(0.0f),
+		NextObjectIndex(0)
+	{}
+};
+
 USTRUCT()
 struct VREXPANSIONPLUGIN_API FUpdateBucketDrop
 {
 	GENERATED_BODY()
 public:
+	FUpdateBucketKey Key;
 	FBucketUpdateTickSignature NativeCallback;
 	FDynamicBucketUpdateTickSignature DynamicCallback;
 	
@@ -45,15 +135,46 @@ public:
 	float nUpdateRate;
 	float nUpdateCount;
 
+	// Callbacks owed when spreading the bucket over its period, the fractional remainder carries between frames
+	float CallbackCredit;
+
+	// Next callback in line when spreading
+	int32 NextCallbackIndex;
+
 	TArray<FUpdateBucketDrop> Callbacks;
 
-	bool Update(float DeltaTime);
+	// Slot of each callback in the array above
+	TMap<FUpdateBucketKey, int32> CallbackSlots;
 
-	FUpdateBucket() {}
+	// Shared so that a batch function adding a new batch can't move the one that is running
+	TMap<FName, TSharedPtr<FUpdateBucketBatch>> Batches;
+
+	void AddCallback(const FUpdateBucketDrop& NewCallback);
+	void AddBatchObject(FName BatchName, UObject* InObject, const UClass* ObjectClass, const FBucketUpdateBatchFunction& BatchFunction);
+
+	// False if the named batch already exists for a different class
+	bool CanAddBatchObject(FName BatchName, const UClass* ObjectClass) const;
+
+	// Swap removes, the last callback in the bucket takes over the slot
+	bool RemoveCallback(const FUpdateBucketKey& Key);
+	void RemoveCallbackAt(int32 Index);
+
+	// BudgetEndTime is in FPlatformTime::Seconds, 0 for no budget
+	// Callbacks that finished or were invalid get removed and added to OutRemovedCallbacks
+	bool Update(float DeltaTime, bool bSpreadOverPeriod, double BudgetEndTime, TArray<FUpdateBucketKey>& OutRemovedCallbacks);
+
+	FUpdateBucket() :
+		nUpdateRate(1.0f),
+		nUpdateCount(0.0f),
+		CallbackCredit(0.0f),
+		NextCallbackIndex(0)
+	{}
 
 	FUpdateBucket(uint32 UpdateHTZ) :
 		nUpdateRate(1.0f / UpdateHTZ),
-		nUpdateCount(0.0f)
+		nUpdateCount(0.0f),
+		CallbackCredit(0.0f),
+		NextCallbackIndex(0)
 	{
 	}
 };
@@ -68,17 +189,67 @@ public:
 	bool bNeedsUpdate;
 	TMap<uint32, FUpdateBucket> ReplicationBuckets;
 
+	// Which bucket each callback is in, so adds / removes / lookups don't have to scan every bucket
+	TMap<FUpdateBucketKey, uint32> CallbackBuckets;
+
+	// Every callback registered for an object, for the object wide removes and lookups
+	TMultiMap<TObjectKey<UObject>, FUpdateBucketKey> ObjectCallbacks;
+
 	void UpdateBuckets(float DeltaTime);
 
+	// Replaces any existing entry with the same key
+	void AddBucketDrop(uint32 UpdateHTZ, const FUpdateBucketDrop& NewDrop);
+	bool RemoveBucketKey(const FUpdateBucketKey& Key);
+
 	bool AddBucketObject(uint32 UpdateHTZ, UObject* InObject, FName FunctionName);
 	bool AddBucketObject(uint32 UpdateHTZ, FDynamicBucketUpdateTickSignature &Delegate);
 
-	/*
-	template<typename classType>
-	bool AddReplicatingObject(uint32 UpdateHTZ, classType* InObject, void(classType::* _Func)())
+	// Native version that skips reflection, CallbackName identifies the entry for replacing and removal
+	template<typename ClassType>
+	bool AddNativeBucketObject(uint32 UpdateHTZ, ClassType* InObject, bool(ClassType::* InFunc)(), FName CallbackName)
 	{
+		static_assert(TIsDerivedFrom<ClassType, UObject>::Value, "Native bucket objects must be UObjects");
+
+		if (!InObject || !InFunc || CallbackName.IsNone() || UpdateHTZ < 1)
+			return false;
+
+		FUpdateBucketDrop NewDrop;
+		NewDrop.Key = FUpdateBucketKey(InObject, CallbackName, EUpdateBucketCallbackType::Native);
+		NewDrop.FunctionName = CallbackName;
+		NewDrop.NativeCallback.BindUObject(InObject, InFunc);
+
+		AddBucketDrop(UpdateHTZ, NewDrop);
+		return true;
 	}
-	*/
+
+	// Adds the object to the named batch in the bucket, the whole batch shares one function that gets passed runs of its objects
+	// The first registered function and class are kept for the batch, adding an object of a different class under the same name fails
+	template<typename ClassType>
+	bool AddBatchedBucketObject(uint32 UpdateHTZ, ClassType* InObject, FName BatchName, TFunction<void(TArrayView<ClassType* const>)> BatchFunction)
+	{
+		static_assert(TIsDerivedFrom<ClassType, UObject>::Value, "Batched bucket objects must be UObjects");
+
+		if (!InObject || !BatchFunction)
+			return false;
+
+		return AddUntypedBatchedBucketObject(UpdateHTZ, InObject, BatchName, ClassType::StaticClass(), [BatchFunction](TArrayView<UObject* const> Objects)
+		{
+			TArray<ClassType*, TInlineAllocator<64>> TypedObjects;
+			TypedObjects.Reserve(Objects.Num());
+			for (UObject* Object : Objects)
+			{
+				TypedObjects.Add(static_cast<ClassType*>(Object));
+			}
+
+			BatchFunction(TypedObjects);
+		});
+	}
+
+	// ObjectClass is what the batch function expects its objects to be, InObject has to be one
+	bool AddUntypedBatchedBucketObject(uint32 UpdateHTZ, UObject* InObject, FName BatchName, const UClass* ObjectClass, const FBucketUpdateBatchFunction& BatchFunction);
+
+	bool RemoveNativeBucketObject(UObject* ObjectToRemove, FName CallbackName);
+	bool RemoveBatchedBucketObject(UObject* ObjectToRemove, FName BatchName);
 
 	bool RemoveBucketObject(UObject * ObjectToRemove, FName FunctionName);
 	bool RemoveBucketObject(FDynamicBucketUpdateTickSignature &DynEvent);
@@ -120,6 +291,31 @@ public:
 	// If one of the bucket contains an entry with the function already then the existing one is removed and the new one is added
 	bool AddObjectToBucket(int32 UpdateHTZ, UObject* InObject, FName FunctionName);
 
+	// Native version of the above that binds the member function directly instead of going through reflection
+	// Return false from the function to be removed from the bucket
+	template<typename ClassType>
+	bool AddNativeObjectToBucket(int32 UpdateHTZ, ClassType* InObject, bool(ClassType::* InFunc)(), FName CallbackName)
+	{
+		if (!InObject || UpdateHTZ < 1)
+			return false;
+
+		return BucketContainer.AddNativeBucketObject(UpdateHTZ, InObject, InFunc, CallbackName);
+	}
+
+	// Adds an object to a named batch in the update bucket with the set HTZ, the batch function is called once with runs of its objects
+	// rather than once per object
+	template<typename ClassType>
+	bool AddObjectToBatchedBucket(int32 UpdateHTZ, ClassType* InObject, FName BatchName, TFunction<void(TArrayView<ClassType* const>)> BatchFunction)
+	{
+		if (!InObject || UpdateHTZ < 1)
+			return false;
+
+		return BucketContainer.AddBatchedBucketObject<ClassType>(UpdateHTZ, InObject, BatchName, MoveTemp(BatchFunction));
+	}
+
+	bool RemoveNativeObjectFromBucket(UObject* InObject, FName CallbackName);
+	bool RemoveObjectFromBatchedBucket(UObject* InObject, FName BatchName);
+
 	// Adds an object to an update bucket with the set HTZ, calls the passed in UFUNCTION name
 	// If one of the bucket contains an entry with the function already then the existing one is removed and the new one is added
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Add Object to Bucket Updates", ScriptName = "AddObjectToBucket"), Category = "BucketUpdateSubsystem")
@@ -13,6 +13,7 @@
 #include "Chaos/SimCallbackObject.h"
 #include "Chaos/SimCallbackInput.h"
 #include "Chaos/ParticleHandle.h"
+#include <atomic>
 //#include "Chaos/ContactModification.h"
 //#include "PBDRigidsSolver.h"
 
@@ -24,6 +25,7 @@
 
 
 DECLARE_LOG_CATEGORY_EXTERN(VRE_CollisionIgnoreLog, Log, All);
+DECLARE_STATS_GROUP(TEXT("VRCollisionIgnore"), STATGROUP_CollisionIgnore, STATCAT_Advanced);
 
 
 USTRUCT()
@@ -53,6 +55,30 @@ struct FChaosParticlePair
 			(ParticleHandle1 == Other.ParticleHandle1 || ParticleHandle1 == Other.ParticleHandle0)
 			);
 	}
+
+	// Order independent to match the equality operator, the contact pair can come in either way around
+	friend uint32 GetTypeHash(const FChaosParticlePair& InKey)
+	{
+		const UPTRINT Handle0 = (UPTRINT)InKey.ParticleHandle0;
+		const UPTRINT Handle1 = (UPTRINT)InKey.ParticleHandle1;
+		return HashCombine(GetTypeHash(FMath::Min(Handle0, Handle1)), GetTypeHash(FMath::Max(Handle0, Handle1)));
+	}
+};
+
+// A single pair being added to or removed from the physics thread ignore set
+struct FChaosParticlePairDelta
+{
+	FChaosParticlePair Pair;
+
+	// Increasing per change, lets the physics thread skip deltas it has already applied
+	int32 Serial;
+	bool bAdded;
+
+	FChaosParticlePairDelta(const FChaosParticlePair& InPair, int32 InSerial, bool bInAdded) :
+		Pair(InPair),
+		Serial(InSerial),
+		bAdded(bInAdded)
+	{}
 };
 
 /*
@@ -63,10 +89,12 @@ struct FSimCallbackInputVR : public Chaos::FSimCallbackInput
 	virtual ~FSimCallbackInputVR() {}
 	void Reset() 
 	{
-		ParticlePairs.Empty();
+		PairDeltas.Empty();
 	}
 
-	TArray<FChaosParticlePair> ParticlePairs;
+	// Every pair change that the physics thread had not acknowledged yet when this input was built, oldest first.
+	// Inputs can be superseded before a step consumes them, so un-acknowledged changes are re-sent until they are applied.
+	TArray<FChaosParticlePairDelta> PairDeltas;
 
 	bool bIsInitialized;
 };
@@ -78,8 +106,18 @@ struct FSimCallbackNoOutputVR : public Chaos::FSimCallbackOutput
 
 class FCollisionIgnoreSubsystemAsyncCallback : public Chaos::TSimCallbackObject<FSimCallbackInputVR, FSimCallbackNoOutputVR, Chaos::ESimCallbackOptions::ContactModification>
 {
+public:
+
+	// Serial of the last delta applied on the physics thread, read by the game thread to trim its pending changes
+	std::atomic<int32> LastAppliedSerial{ 0 };
 
 private:
+
+	// Persistent ignore set, only touched on the physics thread. Counted in case two tracked pairs share the same bodies
+	TMap<FChaosParticlePair, int32> ParticlePairs_Internal;
+
+	// Applies any new deltas from the current input to the persistent set
+	void ApplyPairDeltas_Internal(const FSimCallbackInputVR* Input);
 	
 	virtual void OnPreSimulate_Internal() override
 	{
@@ -150,6 +188,9 @@ public:
 	UPROPERTY()
 	FName BoneName2;
 
+	// Physics thread handles for the bodies, resolved once when the pair is added
+	FChaosParticlePair ParticlePair;
+
 	// Flip our elements to retain a default ordering in an array
 	void FlipElements()
 	{
@@ -184,6 +225,35 @@ public:
 
 	UPROPERTY()
 	TArray<FCollisionIgnorePair> PairArray;
+
+	// When this pair's queued cleanup check is due, only used with event driven checks
+	double NextCheckTime;
+
+	FCollisionIgnorePairArray()
+	{
+		NextCheckTime = 0.0;
+	}
+};
+
+// Entry in the cleanup check queue, stale entries are skipped when their time no longer matches the tracked pair
+struct FCollisionIgnorePairCheck
+{
+	double CheckTime;
+	FCollisionPrimPair PrimPair;
+
+	FCollisionIgnorePairCheck() :
+		CheckTime(0.0)
+	{}
+
+	FCollisionIgnorePairCheck(double InCheckTime, const FCollisionPrimPair& InPrimPair) :
+		CheckTime(InCheckTime),
+		PrimPair(InPrimPair)
+	{}
+
+	FORCEINLINE bool operator<(const FCollisionIgnorePairCheck& Other) const
+	{
+		return CheckTime < Other.CheckTime;
+	}
 };
 
 UCLASS()
@@ -198,12 +268,17 @@ public:
 		Super()
 	{
 		ContactModifierCallback = nullptr;
+		PairDeltaSerial = 0;
 	}
 
 	FCollisionIgnoreSubsystemAsyncCallback* ContactModifierCallback;
 
+	// Sends the pair changes that the physics thread hasn't acknowledged yet
 	void ConstructInput();
 
+	// Records an ignore pair being added or removed for the physics thread ignore set
+	void QueuePairDelta(const FCollisionIgnorePair& IgnorePair, bool bAdded);
+
 	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override
 	{
 		return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
@@ -224,6 +299,21 @@ public:
 		{
 			GetWorld()->GetTimerManager().ClearTimer(UpdateHandle);
 		}
+
+		for (const TPair<FCollisionPrimPair, FCollisionIgnorePairArray>& KeyPair : CollisionTrackedPairs)
+		{
+			if (KeyPair.Key.Prim1)
+			{
+				KeyPair.Key.Prim1->OnComponentPhysicsStateChanged.RemoveDynamic(this, &UCollisionIgnoreSubsystem::OnTrackedPrimitivePhysicsStateChanged);
+			}
+
+			if (KeyPair.Key.Prim2)
+			{
+				KeyPair.Key.Prim2->OnComponentPhysicsStateChanged.RemoveDynamic(this, &UCollisionIgnoreSubsystem::OnTrackedPrimitivePhysicsStateChanged);
+			}
+		}
+
+		PairCheckQueue.Empty();
 	}
 
 	UPROPERTY()
@@ -240,6 +330,13 @@ public:
 	UFUNCTION(Category = "Collision")
 		void CheckActiveFilters();
 
+	// Event driven alternative to CheckActiveFilters, only checks the pairs that had a change queue a check
+	void ProcessPairChecks();
+
+	// Tracked primitives losing their bodies flag their pairs for a check on the next tick
+	UFUNCTION()
+		void OnTrackedPrimitivePhysicsStateChanged(UPrimitiveComponent* ChangedComponent, EComponentPhysicsStateChange StateChange);
+
 	// #TODO implement this, though it should be rare
 	void InitiateIgnore();
 
@@ -252,4 +349,24 @@ private:
 
 	FTimerHandle UpdateHandle;
 
+	// Min heap of cleanup checks queued by pair changes when using event driven checks
+	TArray<FCollisionIgnorePairCheck> PairCheckQueue;
+
+	void SchedulePairCheck(const FCollisionPrimPair& PrimPair, FCollisionIgnorePairArray& TrackedPairs, double CheckTime);
+	bool IsPairCheckCurrent(const FCollisionIgnorePairCheck& PairCheck) const;
+
+	// Sets the timer to wake up when the earliest pair is due
+	void ScheduleNextPairCheck();
+
+	// Clears out everything that was flagged in RemovedPairs
+	void RemoveFlaggedPairs();
+
+	// Stops tracking a primitive pair and drops any event bindings that aren't needed anymore
+	void UntrackPrimPair(const FCollisionPrimPair& PrimPair);
+	void UnbindPrimitiveEvents(UPrimitiveComponent* Prim);
+
+	// Pair changes waiting on the physics thread, trimmed as it acknowledges them
+	TArray<FChaosParticlePairDelta> PendingPairDeltas;
+	int32 PairDeltaSerial;
+
 };
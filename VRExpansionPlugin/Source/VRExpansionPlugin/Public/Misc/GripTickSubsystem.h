@@ -0,0 +1,118 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "GripTickSubsystem.generated.h"
+
+class UGripMotionControllerComponent;
+class UGripTickSubsystem;
+struct FBPActorGripInformation;
+
+/**
+* Tick function that runs the batched grip tick, this executes in pre physics after every registered controller has updated its tracking
+**/
+USTRUCT()
+struct FGripTickSubsystemTickFunction : public FTickFunction
+{
+	GENERATED_USTRUCT_BODY()
+
+		UGripTickSubsystem* Target;
+
+	FGripTickSubsystemTickFunction() :
+		Target(nullptr)
+	{}
+
+	virtual void ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+	virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FGripTickSubsystemTickFunction> : public TStructOpsTypeTraitsBase2<FGripTickSubsystemTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+// Contiguous buffers of the grips that only need the default grip transform this frame
+// Each grip holds an index into ParentTransforms, which has one entry per gathered controller
+struct VREXPANSIONPLUGIN_API FGripTransformBatch
+{
+	TArray<FTransform> ParentTransforms;
+
+	TArray<int32> ParentIndices;
+	TArray<FTransform> RelativeTransforms;
+	TArray<FTransform> AdditionTransforms;
+	TArray<FTransform> WorldTransforms;
+
+	// Where the results get scattered back to
+	TArray<FBPActorGripInformation*> Grips;
+
+	FORCEINLINE int32 Num() const
+	{
+		return Grips.Num();
+	}
+
+	int32 AddParentTransform(const FTransform& ParentTransform)
+	{
+		return ParentTransforms.Add(ParentTransform);
+	}
+
+	void AddGrip(FBPActorGripInformation& Grip, int32 ParentIndex);
+
+	void Reset()
+	{
+		ParentTransforms.Reset();
+		ParentIndices.Reset();
+		RelativeTransforms.Reset();
+		AdditionTransforms.Reset();
+		WorldTransforms.Reset();
+		Grips.Reset();
+	}
+};
+
+// Runs the grip tick for every controller in the world from one place, so that the default grip transforms
+// can be solved together (and in parallel when there are enough of them) before the per grip logic runs.
+// Controllers register themselves with it at BeginPlay when bUseBatchedGripTick is enabled in the global settings.
+UCLASS()
+class VREXPANSIONPLUGIN_API UGripTickSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	UGripTickSubsystem() :
+		Super()
+	{
+	}
+
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override
+	{
+		return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+		// Not allowing for editor type, controllers don't grip in the editor
+	}
+
+	virtual void Deinitialize() override;
+
+	FGripTickSubsystemTickFunction BatchTickFunction;
+
+	// Adds the controller to the batched grip tick, its grips will no longer be ticked from its own component tick
+	bool RegisterController(UGripMotionControllerComponent* Controller);
+	void UnregisterController(UGripMotionControllerComponent* Controller);
+
+	// Gathers, solves and scatters the default grip transforms and then ticks the grips of every controller that ticked this frame
+	void TickBatchedGrips(float DeltaTime);
+
+private:
+
+	TArray<TWeakObjectPtr<UGripMotionControllerComponent>> Controllers;
+
+	// Re-used every frame to avoid allocations
+	TArray<UGripMotionControllerComponent*> TickingControllers;
+	FGripTransformBatch TransformBatch;
+};
@@ -0,0 +1,80 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "VRServerMoveBatchSubsystem.generated.h"
+
+class UVRCharacterMovementComponent;
+class UVRServerMoveBatchSubsystem;
+
+/**
+* Tick function that processes the queued server moves, this executes in pre physics before the registered movement components tick
+**/
+USTRUCT()
+struct FVRServerMoveBatchTickFunction : public FTickFunction
+{
+	GENERATED_USTRUCT_BODY()
+
+		UVRServerMoveBatchSubsystem* Target;
+
+	FVRServerMoveBatchTickFunction() :
+		Target(nullptr)
+	{}
+
+	virtual void ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+	virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FVRServerMoveBatchTickFunction> : public TStructOpsTypeTraitsBase2<FVRServerMoveBatchTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+// Processes the ServerMove RPCs of every VR character in the world from one scheduled pass instead of inline as the packets arrive.
+// Movement components register themselves with it at BeginPlay on the server when bUseBatchedServerMoves is enabled in the global settings,
+// their received moves are queued and then ran here in pre physics, round robin with an optional time budget so the server tick stays flat.
+UCLASS()
+class VREXPANSIONPLUGIN_API UVRServerMoveBatchSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	UVRServerMoveBatchSubsystem() :
+		Super()
+	{
+		NextComponentIndex = 0;
+	}
+
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override
+	{
+		return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+		// Not allowing for editor type, there are no server moves in the editor
+	}
+
+	virtual void Deinitialize() override;
+
+	FVRServerMoveBatchTickFunction BatchTickFunction;
+
+	// Adds the movement component to the batched server moves, its received moves will be queued until the next batch pass
+	bool RegisterMovementComponent(UVRCharacterMovementComponent* MovementComponent);
+	void UnregisterMovementComponent(UVRCharacterMovementComponent* MovementComponent);
+
+	// Runs the queued moves of every registered movement component
+	void ProcessQueuedServerMoves(float DeltaTime);
+
+private:
+
+	TArray<TWeakObjectPtr<UVRCharacterMovementComponent>> MovementComponents;
+
+	// Where the next pass starts so that a time budget doesn't always starve the same characters
+	int32 NextComponentIndex;
+};
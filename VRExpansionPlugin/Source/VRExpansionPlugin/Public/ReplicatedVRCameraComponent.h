@@ -134,6 +134,29 @@ public:
 	// Max distance to allow smoothing before snapping entirely to the new position
 	UPROPERTY(EditAnywhere, Category = "ReplicatedCamera|Networking|Smoothing", meta = (editcondition = "bUseExponentialSmoothing"))
 		float NetworkNoSmoothUpdateDistance = 100.f;
+
+	// If true then replicated transforms are buffered and played back SnapshotPlayoutDelay behind the newest one with hermite interpolation
+	// Overrides the other smoothing modes, absorbs variable latency at the cost of the added delay
+	// The owning client stamps its sends with its own time when this is on so playback follows when they were captured, keep it the same on every machine
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ReplicatedCamera|Networking|Smoothing", meta = (editcondition = "bSmoothReplicatedMotion"))
+		bool bUseSnapshotInterpolation = false;
+
+	// How far behind the newest snapshot to play back, should cover the update interval plus the expected jitter
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ReplicatedCamera|Networking|Smoothing", meta = (editcondition = "bUseSnapshotInterpolation", ClampMin = "0", UIMin = "0"))
+		float SnapshotPlayoutDelay = 0.05f;
+
+	// Max time to extrapolate past the newest snapshot when the buffer runs dry
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ReplicatedCamera|Networking|Smoothing", meta = (editcondition = "bUseSnapshotInterpolation", ClampMin = "0", UIMin = "0"))
+		float MaxSnapshotExtrapolationTime = 0.05f;
+
+	FVRSnapshotInterpolationBuffer SnapshotBuffer;
+
+	// Returns the playback stats of the snapshot buffer, use this to tune the playout delay
+	UFUNCTION(BlueprintPure, Category = "ReplicatedCamera|Networking")
+		FBPVRSnapshotBufferStats GetSnapshotBufferStats() const;
+
+	UFUNCTION(BlueprintCallable, Category = "ReplicatedCamera|Networking")
+		void ResetSnapshotBufferStats();
 	
 	UFUNCTION()
     virtual void OnRep_ReplicatedCameraTransform();
@@ -154,6 +177,9 @@ public:
 	typedef void (AVRBaseCharacter::*VRBaseCharTransformRPC_Pointer)(FBPVRComponentPosRep NewTransform);
 	VRBaseCharTransformRPC_Pointer OverrideSendTransform;
 
+	// Set by the owning character when it sends our transform in its coalesced pose, we only keep it stored out then
+	bool bCoalesceTransformSend;
+
 	// Need this as I can't think of another way for an actor component to make sure it isn't on the server
 	inline bool IsLocallyControlled() const
 	{
@@ -745,7 +745,9 @@ enum class EVRRotationQuantization : uint8
 	/** Each rotation component will be rounded to 10 bits (1024 values). */
 	RoundTo10Bits = 0,
 	/** Each rotation component will be rounded to a short. */
-	RoundToShort = 1
+	RoundToShort = 1,
+	/** The rotation is sent as a smallest three quaternion with 10 bits per element, also allows delta compressing the position. */
+	RoundToSmallestThree = 2
 };
 
 
@@ -769,6 +771,22 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = Replication, AdvancedDisplay)
 		EVRRotationQuantization RotationQuantizationLevel;
 
+	// How the position is encoded, only sent with smallest three rotations
+	// Keyframes are absolute positions that the receiver stores and acks by ID, deltas are offsets from an acked keyframe
+	enum class EPositionEncoding : uint8
+	{
+		Absolute = 0,
+		Keyframe = 1,
+		Delta = 2
+	};
+
+	EPositionEncoding PositionEncoding;
+	uint8 KeyframeID;
+
+	// Senders world time when this was captured, snapshot interpolation plays it back on the senders timeline with it
+	// Not a UPROPERTY so that a new timestamp alone doesn't trigger replication, 0 if it wasn't stamped
+	float Timestamp;
+
 	FORCEINLINE uint16 CompressAxisTo10BitShort(float Angle)
 	{
 		// map [0->360) to [0->1024) and mask off any winding
@@ -782,9 +800,19 @@ public:
 		return (Angle * 360.f / 1024.f);
 	}
 
+	// Rounds the position the same way that serializing it would
+	static FVector QuantizePosition(const FVector& InPosition, EVRVectorQuantization InQuantizationLevel)
+	{
+		const float Scale = InQuantizationLevel == EVRVectorQuantization::RoundTwoDecimals ? 100.0f : 10.0f;
+		return FVector(FMath::RoundToFloat(InPosition.X * Scale) / Scale, FMath::RoundToFloat(InPosition.Y * Scale) / Scale, FMath::RoundToFloat(InPosition.Z * Scale) / Scale);
+	}
+
 	FBPVRComponentPosRep():
 		QuantizationLevel(EVRVectorQuantization::RoundTwoDecimals),
-		RotationQuantizationLevel(EVRRotationQuantization::RoundToShort)
+		RotationQuantizationLevel(EVRRotationQuantization::RoundToShort),
+		PositionEncoding(EPositionEncoding::Absolute),
+		KeyframeID(0),
+		Timestamp(0.0f)
 	{
 		//QuantizationLevel = EVRVectorQuantization::RoundTwoDecimals;
 		Position = FVector::ZeroVector;
@@ -800,7 +828,42 @@ public:
 		// Defines the level of Quantization
 		//uint8 Flags = (uint8)QuantizationLevel;
 		Ar.SerializeBits(&QuantizationLevel, 1); // Only two values 0:1
-		Ar.SerializeBits(&RotationQuantizationLevel, 1); // Only two values 0:1
+		Ar.SerializeBits(&RotationQuantizationLevel, 2); // Three values 0:2
+
+		// A malformed packet, there is nothing to read for the fourth value and the rest of the bunch would be misaligned
+		if (RotationQuantizationLevel > EVRRotationQuantization::RoundToSmallestThree)
+		{
+			Ar.SetError();
+			bOutSuccess = false;
+			return bOutSuccess;
+		}
+
+		if (RotationQuantizationLevel == EVRRotationQuantization::RoundToSmallestThree)
+		{
+			Ar.SerializeBits(&PositionEncoding, 2);
+
+			if (PositionEncoding != EPositionEncoding::Absolute)
+			{
+				Ar.SerializeBits(&KeyframeID, 4);
+			}
+		}
+		else if (Ar.IsLoading())
+		{
+			PositionEncoding = EPositionEncoding::Absolute;
+		}
+
+		// Only costs the bit when nothing is stamping it
+		bool bHasTimestamp = Timestamp > 0.0f;
+		Ar.SerializeBits(&bHasTimestamp, 1);
+
+		if (bHasTimestamp)
+		{
+			Ar << Timestamp;
+		}
+		else if (Ar.IsLoading())
+		{
+			Timestamp = 0.0f;
+		}
 
 		// No longer using their built in rotation rep, as controllers will rarely if ever be at 0 rot on an axis and 
 		// so the 1 bit overhead per axis is just that, overhead
@@ -846,6 +909,12 @@ public:
 				Ar << ShortYaw;
 				Ar << ShortRoll;
 			}break;
+
+			case EVRRotationQuantization::RoundToSmallestThree:
+			{
+				FQuat RotationQuat = Rotation.Quaternion();
+				bOutSuccess &= FTransform_NetQuantize::SerializeQuat_SmallestThree<10>(Ar, RotationQuat);
+			}break;
 			}
 		}
 		else // If loading
@@ -881,6 +950,13 @@ public:
 				Rotation.Yaw = FRotator::DecompressAxisFromShort(ShortYaw);
 				Rotation.Roll = FRotator::DecompressAxisFromShort(ShortRoll);
 			}break;
+
+			case EVRRotationQuantization::RoundToSmallestThree:
+			{
+				FQuat RotationQuat = FQuat::Identity;
+				bOutSuccess &= FTransform_NetQuantize::SerializeQuat_SmallestThree<10>(Ar, RotationQuat);
+				Rotation = RotationQuat.Rotator();
+			}break;
 			}
 		}
 
@@ -899,6 +975,102 @@ struct TStructOpsTypeTraits< FBPVRComponentPosRep > : public TStructOpsTypeTrait
 	};
 };
 
+// Playback stats for a snapshot interpolation buffer, for tuning the playout delay per connection
+USTRUCT(BlueprintType, Category = "VRExpansionLibrary")
+struct VREXPANSIONPLUGIN_API FBPVRSnapshotBufferStats
+{
+	GENERATED_BODY()
+public:
+
+	UPROPERTY(BlueprintReadOnly, Category = "SnapshotBuffer")
+		int32 SnapshotsReceived;
+
+	// Times playback ran past the newest snapshot before the next one came in
+	UPROPERTY(BlueprintReadOnly, Category = "SnapshotBuffer")
+		int32 Underruns;
+
+	// Total time spent extrapolating because of underruns
+	UPROPERTY(BlueprintReadOnly, Category = "SnapshotBuffer")
+		float UnderrunTime;
+
+	// How far ahead of playback the newest snapshot is, negative when extrapolating
+	UPROPERTY(BlueprintReadOnly, Category = "SnapshotBuffer")
+		float BufferedTime;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SnapshotBuffer")
+		float AverageBufferedTime;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SnapshotBuffer")
+		float MinBufferedTime;
+
+	FBPVRSnapshotBufferStats() :
+		SnapshotsReceived(0),
+		Underruns(0),
+		UnderrunTime(0.0f),
+		BufferedTime(0.0f),
+		AverageBufferedTime(0.0f),
+		MinBufferedTime(0.0f)
+	{}
+};
+
+// Buffer of replicated poses that is played back a fixed delay behind the newest one so that variable latency
+// gets absorbed instead of showing up as stutter. Positions are hermite interpolated and rotations use squad.
+// Snapshots are placed on the senders timeline, which is mapped to local time with an offset that follows the
+// fastest arrivals so that the arrival jitter doesn't end up in the playback.
+struct VREXPANSIONPLUGIN_API FVRSnapshotInterpolationBuffer
+{
+public:
+
+	static const int32 MaxSnapshots = 16;
+
+	struct FSnapshot
+	{
+		double Time;
+		FVector Position;
+		FQuat Rotation;
+	};
+
+	FBPVRSnapshotBufferStats Stats;
+
+	FVRSnapshotInterpolationBuffer() :
+		LastPlayoutTime(0.0),
+		ClockOffset(0.0),
+		bHasClockOffset(false),
+		PendingUnderrunTime(0.0f),
+		bExtrapolating(false),
+		bHasBufferedSample(false)
+	{}
+
+	void Reset();
+	void ResetStats();
+
+	// Time is the senders time for the snapshot, ReceiveTime is the local time it arrived at
+	void AddSnapshot(double Time, double ReceiveTime, const FVector& Position, const FQuat& Rotation);
+
+	// Samples the buffer PlayoutDelay behind LocalTime on the senders timeline, the out values are always valid if there are any snapshots
+	// Returns false once playback has settled on the newest snapshot and there is nothing left to play
+	bool Sample(double LocalTime, float PlayoutDelay, float MaxExtrapolationTime, FVector& OutPosition, FQuat& OutRotation);
+
+	FORCEINLINE int32 Num() const
+	{
+		return Snapshots.Num();
+	}
+
+private:
+
+	TArray<FSnapshot, TInlineAllocator<MaxSnapshots>> Snapshots;
+	double LastPlayoutTime;
+
+	// Local time minus sender time
+	double ClockOffset;
+	bool bHasClockOffset;
+
+	// Only counted as an underrun if a snapshot comes in while we are still extrapolating, otherwise the hand just stopped
+	float PendingUnderrunTime;
+	bool bExtrapolating;
+	bool bHasBufferedSample;
+};
+
 UENUM(Blueprintable)
 enum class EGripCollisionType : uint8
 {
@@ -1494,9 +1666,35 @@ public:
 		bool bWasInitiallyRepped;
 		uint8 CachedGripID;
 
+		// Interface values resolved at grip time so the tick doesn't have to query them every frame (bCacheGripInterfaceValues)
+		// Cleared by NotifyGripSettingsChanged on the controller, or if the gripped object changes
+		bool bInterfaceCacheValid;
+		bool bRootHasInterface;
+		bool bActorHasInterface;
+		float CachedBreakDistance;
+		const UObject* CachedInterfaceObject;
+		TArray<FWeakObjectPtr, TInlineAllocator<4>> CachedGripScripts;
+
+		// Result of the last batched end physics sweep, consumed on the next grip tick
+		bool bHasBatchedSweepResult;
+		bool bBatchedSweepHit;
+
+		// Default grip transform solved by the grip tick subsystem this frame, consumed by the grip tick
+		bool bHasBatchedWorldTransform;
+		FTransform BatchedWorldTransform;
+
 		FGripValueCache() :
 			bWasInitiallyRepped(false),
-			CachedGripID(INVALID_VRGRIP_ID)
+			CachedGripID(INVALID_VRGRIP_ID),
+			bInterfaceCacheValid(false),
+			bRootHasInterface(false),
+			bActorHasInterface(false),
+			CachedBreakDistance(0.0f),
+			CachedInterfaceObject(nullptr),
+			bHasBatchedSweepResult(false),
+			bBatchedSweepHit(false),
+			bHasBatchedWorldTransform(false),
+			BatchedWorldTransform(FTransform::Identity)
 		{}
 
 	}ValueCache;
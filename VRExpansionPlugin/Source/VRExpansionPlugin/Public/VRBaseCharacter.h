@@ -13,6 +13,7 @@ class AVRPlayerController;
 class UGripMotionControllerComponent;
 class UParentRelativeAttachmentComponent;
 class AController;
+class AVRBaseCharacter;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogBaseVRCharacter, Log, All);
 
@@ -265,6 +266,129 @@ struct TStructOpsTypeTraits< FVRReplicatedCapsuleHeight > : public TStructOpsTyp
 	};
 };
 
+// The camera, both hands and any extra tracked controllers in a single update with a shared timestamp
+// Only the components that changed since the last send are written
+USTRUCT()
+struct VREXPANSIONPLUGIN_API FVRCoalescedPoseRep
+{
+	GENERATED_USTRUCT_BODY()
+public:
+
+	enum ECoalescedPoseFlags : uint8
+	{
+		PoseHasCamera = 1 << 0,
+		PoseHasLeftController = 1 << 1,
+		PoseHasRightController = 1 << 2
+	};
+
+	// Client world time when the pose was sampled
+	UPROPERTY()
+		float Timestamp;
+
+	UPROPERTY()
+		uint8 ComponentFlags;
+
+	UPROPERTY()
+		FBPVRComponentPosRep CameraTransform;
+
+	UPROPERTY()
+		FBPVRComponentPosRep LeftControllerTransform;
+
+	UPROPERTY()
+		FBPVRComponentPosRep RightControllerTransform;
+
+	// Indexes into the characters CoalescedPoseExtraControllers
+	UPROPERTY()
+		TArray<uint8> ExtraIndices;
+
+	UPROPERTY()
+		TArray<FBPVRComponentPosRep> ExtraTransforms;
+
+	FVRCoalescedPoseRep() :
+		Timestamp(0.0f),
+		ComponentFlags(0)
+	{}
+
+	/** Network serialization */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+	{
+		bOutSuccess = true;
+		bool bComponentSuccess = true;
+
+		Ar << Timestamp;
+		Ar.SerializeBits(&ComponentFlags, 3);
+
+		if (ComponentFlags & PoseHasCamera)
+		{
+			bOutSuccess &= CameraTransform.NetSerialize(Ar, Map, bComponentSuccess);
+		}
+
+		if (ComponentFlags & PoseHasLeftController)
+		{
+			bOutSuccess &= LeftControllerTransform.NetSerialize(Ar, Map, bComponentSuccess);
+		}
+
+		if (ComponentFlags & PoseHasRightController)
+		{
+			bOutSuccess &= RightControllerTransform.NetSerialize(Ar, Map, bComponentSuccess);
+		}
+
+		uint8 NumExtras = (uint8)FMath::Min(ExtraTransforms.Num(), 255);
+		Ar << NumExtras;
+
+		if (Ar.IsLoading())
+		{
+			ExtraIndices.SetNumZeroed(NumExtras);
+			ExtraTransforms.SetNum(NumExtras);
+		}
+
+		for (int32 i = 0; i < NumExtras && !Ar.IsError(); ++i)
+		{
+			Ar << ExtraIndices[i];
+			bOutSuccess &= ExtraTransforms[i].NetSerialize(Ar, Map, bComponentSuccess);
+		}
+
+		return bOutSuccess && !Ar.IsError();
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits< FVRCoalescedPoseRep > : public TStructOpsTypeTraitsBase2<FVRCoalescedPoseRep>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+/**
+* Tick function that sends the coalesced pose, runs post physics after the camera and controllers have updated their tracking
+**/
+USTRUCT()
+struct FVRCoalescedPoseTickFunction : public FTickFunction
+{
+	GENERATED_USTRUCT_BODY()
+
+		AVRBaseCharacter* Target;
+
+	FVRCoalescedPoseTickFunction() :
+		Target(nullptr)
+	{}
+
+	virtual void ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+	virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FVRCoalescedPoseTickFunction> : public TStructOpsTypeTraitsBase2<FVRCoalescedPoseTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
 UCLASS()
 class VREXPANSIONPLUGIN_API AVRBaseCharacter : public ACharacter
 {
@@ -328,6 +452,44 @@ public:
 	UFUNCTION(Unreliable, Server, WithValidation)
 		void Server_SendTransformRightController(FBPVRComponentPosRep NewTransform);
 
+	// If true the owning client sends the camera, both controllers and any extra registered controllers in one RPC with a shared
+	// timestamp instead of each of them sending their own on separate timers, the server feeds them into each components OnRep / smoothing
+	UPROPERTY(EditDefaultsOnly, Category = "VRBaseCharacter|Networking")
+		bool bUseCoalescedPoseReplication;
+
+	// Rate to send the coalesced pose at, replaces the components own update rates when coalescing
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacter|Networking", meta = (editcondition = "bUseCoalescedPoseReplication", ClampMin = "1", UIMin = "1"))
+		float CoalescedPoseNetUpdateRate;
+
+	// Extra tracked controllers (trackers and the like) to send in the coalesced pose
+	// These need to be added in the same order on the server and the owning client, they are sent by index
+	UPROPERTY(BlueprintReadOnly, Transient, Category = "VRBaseCharacter|Networking")
+		TArray<TObjectPtr<UGripMotionControllerComponent>> CoalescedPoseExtraControllers;
+
+	UFUNCTION(BlueprintCallable, Category = "VRBaseCharacter|Networking")
+		bool AddCoalescedPoseController(UGripMotionControllerComponent* ExtraController);
+
+	UFUNCTION(BlueprintCallable, Category = "VRBaseCharacter|Networking")
+		bool RemoveCoalescedPoseController(UGripMotionControllerComponent* ExtraController);
+
+	FVRCoalescedPoseTickFunction CoalescedPoseTickFunction;
+	virtual void RegisterActorTickFunctions(bool bRegister) override;
+
+	// Used in the coalesced pose tick to accumulate before sending updates
+	float CoalescedPoseNetUpdateCount;
+
+	// What we sent last, only changed components get re-sent
+	FVRCoalescedPoseRep LastSentCoalescedPose;
+
+	// Server side, drops poses that arrive out of order
+	float LastReceivedCoalescedPoseTimestamp;
+
+	void TickCoalescedPose(float DeltaTime);
+	void SetCoalescedPoseComponent(UGripMotionControllerComponent* PoseController, bool bAdd);
+
+	UFUNCTION(Unreliable, Server, WithValidation)
+		void Server_SendCoalescedPose(FVRCoalescedPoseRep NewPose);
+
 	virtual void PreReplication(IRepChangedPropertyTracker & ChangedPropertyTracker) override;
 
 	// If true will replicate the capsule height on to clients, allows for dynamic capsule height changes in multiplayer
@@ -17,6 +17,36 @@ DECLARE_LOG_CATEGORY_EXTERN(LogVRBaseCharacterMovement, Log, All);
 /** Delegate for notification when to handle a climbing step up, will override default step up logic if is bound to. */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FVROnPerformClimbingStepUp, FVector, FinalStepUpLocation);
 
+// The last floor computed, re-used while the capsule stays in the same ground cell on the same base
+struct VREXPANSIONPLUGIN_API FVRFloorCache
+{
+	FFindFloorResult FloorResult;
+	FVector CapsuleLocation;
+	FIntPoint Cell;
+	TWeakObjectPtr<UPrimitiveComponent> Base;
+	float LineDistance;
+	float SweepDistance;
+	float SweepRadius;
+	double Time;
+	bool bValid;
+
+	FVRFloorCache() :
+		CapsuleLocation(FVector::ZeroVector),
+		Cell(FIntPoint::ZeroValue),
+		LineDistance(0.f),
+		SweepDistance(0.f),
+		SweepRadius(0.f),
+		Time(0.0),
+		bValid(false)
+	{}
+
+	void Invalidate()
+	{
+		bValid = false;
+		Base.Reset();
+	}
+};
+
 /*
 * The base class for our VR characters, contains common logic across them, not to be used directly
 */
@@ -61,6 +91,44 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Smoothing")
 		bool bDisableSimulatedTickWhenSmoothingMovement;
 
+	// If true simulated proxies lower their update rate and smoothing quality when they are far from the local camera or haven't been rendered recently.
+	// Near characters keep running at full quality.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Smoothing|LOD")
+		bool bUseSimulatedProxyLOD;
+
+	// Distance (cm) from the local camera past which simulated proxies drop to the medium LOD
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Smoothing|LOD", meta = (editcondition = "bUseSimulatedProxyLOD", ClampMin = "0", UIMin = "0"))
+		float SimulatedProxyLODMediumDistance;
+
+	// Distance (cm) from the local camera past which simulated proxies drop to the far LOD
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Smoothing|LOD", meta = (editcondition = "bUseSimulatedProxyLOD", ClampMin = "0", UIMin = "0"))
+		float SimulatedProxyLODFarDistance;
+
+	// Updates per second for the medium LOD, 0 runs every frame
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Smoothing|LOD", meta = (editcondition = "bUseSimulatedProxyLOD", ClampMin = "0", UIMin = "0"))
+		float SimulatedProxyLODMediumUpdateRate;
+
+	// Updates per second for the far LOD, 0 runs every frame
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Smoothing|LOD", meta = (editcondition = "bUseSimulatedProxyLOD", ClampMin = "0", UIMin = "0"))
+		float SimulatedProxyLODFarUpdateRate;
+
+	// If true then proxies that haven't been rendered for SimulatedProxyLODOffscreenTime seconds drop to the far LOD regardless of distance
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Smoothing|LOD", meta = (editcondition = "bUseSimulatedProxyLOD"))
+		bool bSimulatedProxyLODUseVisibility;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Smoothing|LOD", meta = (editcondition = "bUseSimulatedProxyLOD && bSimulatedProxyLODUseVisibility", ClampMin = "0", UIMin = "0"))
+		float SimulatedProxyLODOffscreenTime;
+
+	// The LOD this simulated proxy is currently running at
+	UPROPERTY(BlueprintReadOnly, Transient, Category = "VRBaseCharacterMovementComponent|Smoothing|LOD")
+		EVRSimulatedProxyLOD SimulatedProxyLOD;
+
+	// Time skipped by the LOD since the last simulated tick that ran
+	float SimulatedProxyLODAccumulatedTime;
+
+	// Picks the LOD from the distance to the local camera and the last render time
+	virtual EVRSimulatedProxyLOD GetDesiredSimulatedProxyLOD() const;
+
 	// When true the hmd movement injection speed is capped to the maximum movement speed
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement")
 		bool bCapHMDMovementToMaxMovementSpeed;
@@ -278,6 +346,9 @@ public:
 	/** Update mesh location based on interpolated values. */
 	void SmoothClientPosition_UpdateVRVisuals();
 
+	// Far LOD smoothing, finishes the interpolation in one step so that the visuals are only updated once per correction
+	void SmoothClientPosition_Snap();
+
 	// Added in 4.16
 	///* Allow custom handling when character hits a wall while swimming. */
 	//virtual void HandleSwimmingWallHit(const FHitResult& Hit, float DeltaTime);
@@ -292,6 +363,29 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement")
 		bool bRunControlRotationInMovementComponent;
 
+	// If true then moves with roomscale (HMD) movement are combined as long as the combined straight line movement stays within
+	// RoomscaleCombineMaxError of the path the HMD actually took, instead of refusing whenever the HMD direction changes.
+	// The HMD is never still, without this almost nothing combines in roomscale and the client sends a move nearly every frame.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VRMovement|Networking")
+		bool bUseRoomscaleMoveCombining;
+
+	// Max distance (cm) that the combined roomscale movement can be from the path the HMD took
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VRMovement|Networking", meta = (editcondition = "bUseRoomscaleMoveCombining", ClampMin = "0", UIMin = "0"))
+		float RoomscaleCombineMaxError;
+
+	// Replicated capsule heights within this many cm of each other still combine, the combined move uses the newest height
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VRMovement|Networking", meta = (editcondition = "bUseRoomscaleMoveCombining", ClampMin = "0", UIMin = "0"))
+		float RoomscaleCombineHeightTolerance;
+
+	// If true then the move data sent to the server skips fields that match the previous move in the same packet (or the defaults for the
+	// newest move) behind a presence mask, and writes locations relative to it. Needs to be the same on the server and client.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VRMovement|Networking")
+		bool bUseDeltaCompressedMoveData;
+
+	// Precision to send the roomscale delta at with delta compressed move data
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VRMovement|Networking", meta = (editcondition = "bUseDeltaCompressedMoveData"))
+		EVRMoveDataLFDiffQuantization MoveDataLFDiffQuantization;
+
 	// Moved into compute floor dist
 	// Option to Skip simulating components when looking for floor
 	/*virtual bool FloorSweepTest(
@@ -304,8 +398,44 @@ public:
 		const struct FCollisionResponseParams& ResponseParam
 	) const override;*/
 
+	// Checks the floor cache before running the floor sweeps
 	virtual void ComputeFloorDist(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, FFindFloorResult& OutFloorResult, float SweepRadius, const FHitResult* DownwardSweepResult = NULL) const override;
 
+	// The actual floor sweeps / line traces
+	void ComputeFloorDistUncached(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, FFindFloorResult& OutFloorResult, float SweepRadius, const FHitResult* DownwardSweepResult = NULL) const;
+
+	// If true then the floor result is cached and re-used while the capsule stays within the same FloorCacheCellSize ground cell on the same
+	// (static) base. Roomscale moves the capsule by a few millimetres every frame from the HMD alone, this skips the floor sweeps for them.
+	// FindFloor, StepUp, VRClimbStepUp and MoveAlongFloor all find their floor through here.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|FloorCache")
+		bool bUseFloorCache;
+
+	// Size (cm) of the ground cells that the cached floor is valid for
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|FloorCache", meta = (editcondition = "bUseFloorCache", ClampMin = "0.01", UIMin = "0.01"))
+		float FloorCacheCellSize;
+
+	// How far (cm) the capsule can move vertically and still use the cached floor
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|FloorCache", meta = (editcondition = "bUseFloorCache", ClampMin = "0", UIMin = "0"))
+		float FloorCacheHeightTolerance;
+
+	// How long (seconds) the cached floor is valid for before it is swept again anyway
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|FloorCache", meta = (editcondition = "bUseFloorCache", ClampMin = "0", UIMin = "0"))
+		float FloorCacheMaxAge;
+
+	// Returns the fraction of floor queries that were served by the floor cache since the last reset
+	UFUNCTION(BlueprintCallable, Category = "VRMovement|FloorCache")
+		float GetFloorCacheHitRate(int32& OutHits, int32& OutQueries) const;
+
+	UFUNCTION(BlueprintCallable, Category = "VRMovement|FloorCache")
+		void ResetFloorCacheStats();
+
+	UFUNCTION(BlueprintCallable, Category = "VRMovement|FloorCache")
+		void InvalidateFloorCache();
+
+	mutable FVRFloorCache FloorCache;
+	mutable int32 FloorCacheHits;
+	mutable int32 FloorCacheQueries;
+
 	// Need to use actual capsule location for step up
 	virtual bool VRClimbStepUp(const FVector& GravDir, const FVector& Delta, const FHitResult &InHit, FStepDownResult* OutStepDownResult = nullptr);
 
@@ -12,6 +12,7 @@ class FDebugDisplayInfo;
 class ACharacter;
 class AVRCharacter;
 class UVRRootComponent;
+class UVRServerMoveBatchSubsystem;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogVRCharacterMovement, Log, All);
 
@@ -124,6 +125,12 @@ public:
 	// Engines version of this is private for some reason, making it impossible to override the function that uses it.
 	TWeakObjectPtr<UPrimitiveComponent> LastServerMovementBaseVR = nullptr;
 
+	// Moves received since the last batched server move pass
+	TArray<FCharacterServerMovePackedBits> QueuedServerMoves;
+	int32 QueuedServerMoveDeferredFrames;
+
+	TWeakObjectPtr<UVRServerMoveBatchSubsystem> ServerMoveBatchSubsystem;
+
 	virtual void ClientHandleMoveResponse(const FCharacterMoveResponseDataContainer& MoveResponse) override;
 
 	//virtual void SendClientAdjustment() override;
@@ -167,6 +174,21 @@ public:
 
 	virtual void ServerMove_PerformMovement(const FCharacterNetworkMoveData& MoveData) override;
 
+	// Queues the move instead of running it inline when batched server moves are enabled
+	virtual void ServerMovePacked_ServerReceive(const FCharacterServerMovePackedBits& PackedBits) override;
+
+	// True if there are received moves waiting on the next batched server move pass
+	FORCEINLINE bool HasQueuedServerMoves() const
+	{
+		return QueuedServerMoves.Num() > 0;
+	}
+
+	// Called when the batch pass went over its time budget, returns false if the moves have already waited too long and need to run anyway
+	bool DeferQueuedServerMoves(int32 MaxDeferredFrames);
+
+	// Runs the queued moves in the order that they were received
+	void ProcessQueuedServerMoves();
+
 	FNetworkPredictionData_Client* GetPredictionData_Client() const override;
 	FNetworkPredictionData_Server* GetPredictionData_Server() const override;
 
@@ -180,6 +202,8 @@ public:
 	UVRCharacterMovementComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	virtual void OnRegister() override;
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	float ImmersionDepth() const override;
 	bool CanCrouch();
@@ -10,6 +10,7 @@
 //#include "Engine/EngineTypes.h"
 //#include "Engine/EngineBaseTypes.h"
 #include "TimerManager.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "VRGestureComponent.generated.h"
 
 DECLARE_STATS_GROUP(TEXT("TICKGesture"), STATGROUP_TickGesture, STATCAT_Advanced);
@@ -103,10 +104,29 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VRGesture")
 		FVRGestureSettings GestureSettings;
 
+	// Bounds of the samples, used as the lower bound envelope when pruning during detection
+	// Rebuilt by CalculateSizeOfGesture, or lazily if it was invalidated or the sample count no longer matches
+	FBox SampleEnvelope;
+	int EnvelopeSampleCount;
+
 	FVRGesture()
 	{
 		GestureType = 0;
 		GestureSize = FBox();
+		SampleEnvelope = FBox(ForceInit);
+		EnvelopeSampleCount = -1;
+	}
+
+	void CalculateEnvelope()
+	{
+		SampleEnvelope = FBox(Samples);
+		EnvelopeSampleCount = Samples.Num();
+	}
+
+	// Call when the samples were edited in place, the envelope is rebuilt on the next detection
+	void InvalidateEnvelope()
+	{
+		EnvelopeSampleCount = -1;
 	}
 
 	void CalculateSizeOfGesture(bool bAllowResizing = false, float TargetExtentSize = 1.f)
@@ -137,9 +157,47 @@ public:
 			GestureSize.Min *= Scaler;
 			GestureSize.Max *= Scaler;
 		}
+
+		CalculateEnvelope();
 	}
 };
 
+// Contiguous structure of arrays copy of a gesture database, the samples of every gesture are packed back to back.
+// Immutable once baked so that it can be shared with recognition tasks running off of the game thread.
+struct VREXPANSIONPLUGIN_API FVRGestureBakedDatabase
+{
+public:
+
+	struct FBakedGesture
+	{
+		// Range of this gestures samples in the packed arrays
+		int SampleOffset;
+		int SampleCount;
+
+		FBox Envelope;
+		FVRGestureSettings Settings;
+	};
+
+	TArray<FBakedGesture> Gestures;
+
+	// Samples stay in the same (reversed) order as FVRGesture::Samples
+	TArray<float> SampleX;
+	TArray<float> SampleY;
+	TArray<float> SampleZ;
+
+	// Mirroring only flips Y, pre-negated so mirrored checks run through the same kernel
+	TArray<float> MirroredSampleY;
+
+	// The databases edit serial at bake time, any edit through the database bumps it
+	uint32 SourceEditSerial = 0;
+
+	// Packs the source gestures into the arrays
+	void Bake(const TArray<FVRGesture>& SourceGestures, uint32 EditSerial);
+
+	// True if the source gestures were edited or no longer line up with what was baked
+	bool IsOutOfDate(const TArray<FVRGesture>& SourceGestures, uint32 EditSerial) const;
+};
+
 /**
 * Items Database DataAsset, here we can save all of our game items
 */
@@ -159,6 +217,7 @@ public:
 	UGesturesDatabase()
 	{
 		TargetGestureScale = 100.0f;
+		GestureEditSerial = 0;
 	}
 
 	// Recalculate size of gestures and re-scale them to the TargetGestureScale (if bScaleToDatabase is true)
@@ -173,6 +232,26 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "VRGestures")
 		bool ImportSplineAsGesture(USplineComponent * HostSplineComponent, FString GestureName, bool bKeepSplineCurves = true, float SegmentLen = 10.0f, bool bScaleToDatabase = true);
 
+	// Flags the baked gestures and the gesture envelopes to be rebuilt on next use, call this after editing gesture samples or settings at runtime
+	// (adding or removing gestures or samples is picked up automatically)
+	UFUNCTION(BlueprintCallable, Category = "VRGestures")
+		void MarkBakedGesturesDirty();
+
+	// Returns the baked structure of arrays copy of the gestures, re-baking first if it is out of date
+	TSharedPtr<const FVRGestureBakedDatabase, ESPMode::ThreadSafe> GetBakedGestures();
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+
+	// Tasks hold their own reference, so re-baking never pulls the data out from under them
+	TSharedPtr<const FVRGestureBakedDatabase, ESPMode::ThreadSafe> BakedGestures;
+
+	// Bumped by MarkBakedGesturesDirty (editor changes, saved recordings, imports), the bake is keyed on it
+	// so that samples or settings edited in place with the same count still re-bake
+	uint32 GestureEditSerial;
 };
 
 
@@ -204,6 +283,125 @@ public:
 	~FVRGestureSplineDraw();
 };
 
+// Rolling subsequence DTW state for a single database gesture (one normal and one mirrored per gesture)
+// Only the last cost column is kept, so each new input sample is an O(GestureLength) update instead of a full matrix rebuild.
+// Input is consumed oldest to newest and the gesture is walked from its first drawn point to its last, with a free start point.
+struct VREXPANSIONPLUGIN_API FVRGestureDTWStream
+{
+public:
+
+	// Double buffered columns (previous / current input sample), sized to the gesture length + 1
+	TArray<float> CostColumns[2];
+	TArray<int> SlopeIColumns[2];
+	TArray<int> SlopeJColumns[2];
+
+	// Absolute input sample index that the path ending in each cell started at
+	TArray<int> StartColumns[2];
+
+	// Which of the double buffered columns is the latest one
+	int CurrentColumn;
+
+	// Absolute count of input samples that have been pushed into this stream
+	int ConsumedSamples;
+
+	// Scaler that was applied to the input samples when they were pushed
+	float Scaler;
+
+	int GestureLength;
+	bool bMirrored;
+	bool bNeedsRebuild;
+
+	FVRGestureDTWStream()
+	{
+		CurrentColumn = 0;
+		ConsumedSamples = 0;
+		Scaler = 1.f;
+		GestureLength = 0;
+		bMirrored = false;
+		bNeedsRebuild = true;
+	}
+
+	// Clears the columns back to the empty state, only re-allocates if the gesture length changed
+	void Init(int InGestureLength, bool bInMirrored, float InScaler, int InConsumedSamples);
+
+	// Returns the cost of the best path that ends on the latest input sample, or MAX_FLT if it started before OldestValidSample
+	float GetMatchCost(int OldestValidSample) const;
+};
+
+// A database gesture that passed the first threshold and is waiting on a full DTW check
+struct VREXPANSIONPLUGIN_API FVRGestureMatchCandidate
+{
+public:
+
+	int GestureIndex;
+	bool bMirrored;
+	float Scaler;
+
+	// Lower bound of the normalized DTW cost
+	float LowerBound;
+
+	FVRGestureMatchCandidate(int InGestureIndex, bool bInMirrored, float InScaler, float InLowerBound) :
+		GestureIndex(InGestureIndex),
+		bMirrored(bInMirrored),
+		Scaler(InScaler),
+		LowerBound(InLowerBound)
+	{}
+};
+
+// Snapshot of a detection tick that is recognized on a task graph thread against a baked database
+// Only touches its own data while running, the component picks up the result on its next gesture tick
+struct VREXPANSIONPLUGIN_API FVRGestureRecognitionJob
+{
+public:
+
+	TSharedPtr<const FVRGestureBakedDatabase, ESPMode::ThreadSafe> BakedDatabase;
+
+	// Database and recording this job was launched for, used to throw out stale results
+	TWeakObjectPtr<UGesturesDatabase> SourceDatabase;
+	int RecordingSerial;
+
+	// Un-scaled input samples, newest first
+	TArray<float> InputX;
+	TArray<float> InputY;
+	TArray<float> InputZ;
+
+	FBox InputBounds;
+	FVector InputSize;
+	float Scaler;
+	EVRGestureMirrorMode MirroringHand;
+	int MaxSlope;
+
+	// Result, INDEX_NONE if nothing was detected
+	int OutGestureIndex;
+	float OutCost;
+
+	FVRGestureRecognitionJob()
+	{
+		RecordingSerial = 0;
+		InputBounds = FBox(ForceInit);
+		InputSize = FVector::ZeroVector;
+		Scaler = 1.f;
+		MirroringHand = EVRGestureMirrorMode::GES_NoMirror;
+		MaxSlope = 3;
+		OutGestureIndex = INDEX_NONE;
+		OutCost = MAX_FLT;
+	}
+
+	void Run();
+
+private:
+
+	float GetLowerBound(const FVRGestureBakedDatabase::FBakedGesture& Gesture, bool bMirrored, float InScaler, float AbandonCost);
+	float DTW(const FVRGestureBakedDatabase::FBakedGesture& Gesture, bool bMirrored, float InScaler, float AbandonCost);
+
+	// Scratch space, re-used between runs
+	TArray<FVRGestureMatchCandidate> Candidates;
+	TArray<float> DistanceRow;
+	TArray<float> CostRows[2];
+	TArray<int> SlopeIRows[2];
+	TArray<int> SlopeJRows[2];
+};
+
 /** Delegate for notification when the lever state changes. */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FVRGestureDetectedSignature, uint8, GestureType, FString, DetectedGestureName, int, DetectedGestureIndex, UGesturesDatabase *, GestureDataBase, FVector, OriginalUnscaledGestureSize);
 
@@ -292,6 +490,22 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VRGestures")
 	int maxSlope;
 
+	// If true detection keeps a rolling DTW column per database gesture and updates it once per new sample
+	// instead of re-computing the full DTW matrix for every gesture on every detection tick.
+	// Matches are still limited to the recording buffer size.
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VRGestures|Streaming")
+		bool bUseStreamingDetection;
+
+	// Relative change in the input gestures scaler that is allowed before a streaming gesture is rebuilt from the buffer
+	// The input is re-scaled as its bounds grow, 0.0 will rebuild on every change (exact), higher values trade accuracy for speed
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VRGestures|Streaming", meta = (EditCondition = "bUseStreamingDetection", ClampMin = "0.0", UIMin = "0.0", UIMax = "0.5"))
+		float StreamingRescaleTolerance;
+
+	// If true recognition runs as a task graph job against the databases baked gestures and its result is consumed on the next gesture tick
+	// Streaming detection keeps game thread state and is not used while this is enabled
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VRGestures|Async")
+		bool bUseAsyncDetection;
+
 	UPROPERTY(BlueprintReadOnly, Category = "VRGestures")
 	EVRGestureState CurrentState;
 
@@ -358,11 +572,57 @@ public:
 	// Recognize gesture in the given sequence.
 	// It will always assume that the gesture ends on the last observation of that sequence.
 	// If the distance between the last observations of each sequence is too great, or if the overall DTW distance between the two sequences is too great, no gesture will be recognized.
-	void RecognizeGesture(FVRGesture inputGesture);
-
+	void RecognizeGesture(const FVRGesture& inputGesture);
 
 	// Compute the min DTW distance between seq2 and all possible endings of seq1.
-	float dtw(FVRGesture seq1, FVRGesture seq2, bool bMirrorGesture = false, float Scaler = 1.f);
+	// Abandons early once every remaining path would cost at least AbandonCost, the return value is only exact below it.
+	float dtw(const FVRGesture& seq1, const FVRGesture& seq2, bool bMirrorGesture = false, float Scaler = 1.f, float AbandonCost = MAX_FLT);
+
+	// Returns a lower bound of the un-normalized DTW cost between the input and the gesture (LB_Keogh using the bounds as the envelope).
+	// Every gesture sample has to be matched to at least one input sample, and every input sample lies inside of the input bounds.
+	float GetGestureLowerBound(const FVRGesture& exampleGesture, const FBox& ScaledInputBounds, bool bMirrorGesture, float AbandonCost);
+
+	// Brings the stream up to date with the captured samples and returns the best match cost ending on the latest sample
+	float UpdateGestureStream(FVRGestureDTWStream& Stream, const FVRGesture& inputGesture, const FVRGesture& exampleGesture, bool bMirrorGesture, float Scaler);
+
+	// Pushes a single new input sample through the streams rolling column
+	void PushStreamSample(FVRGestureDTWStream& Stream, const FVRGesture& exampleGesture, const FVector& Sample);
+
+	// Flags all of the streams to be rebuilt from the buffer on their next update
+	void InvalidateGestureStreams();
+
+	// Kicks off a recognition task for the input if the last one has been consumed
+	void LaunchAsyncRecognition(const FVRGesture& inputGesture);
+
+	// Picks up the result of the last recognition task if it has finished
+	void ConsumeAsyncRecognition();
+
+	// Drops any in flight recognition task, it finishes on its own and its result is ignored
+	void AbandonAsyncRecognition();
+
+private:
+
+	// Total number of samples captured since recording started, used to sync streams to the ring buffer
+	int TotalCapturedSamples;
+
+	// Two streams per database gesture, [Index * 2] is normal and [Index * 2 + 1] is mirrored
+	TArray<FVRGestureDTWStream> GestureStreams;
+
+	// Database that the streams were built for
+	TWeakObjectPtr<UGesturesDatabase> StreamedDatabase;
+
+	// Gestures that passed the first threshold this detection tick, sorted by their lower bound
+	TArray<FVRGestureMatchCandidate> MatchCandidates;
+
+	// Bumped whenever the recording buffer is cleared, async results launched before that are stale
+	int RecordingSerial;
+
+	TSharedPtr<FVRGestureRecognitionJob, ESPMode::ThreadSafe> RecognitionJob;
+	FGraphEventRef RecognitionTask;
 
+	// Scratch tables for the full DTW, kept around so that they are not re-allocated every call
+	TArray<float> DTWLookupTable;
+	TArray<int> DTWSlopeI;
+	TArray<int> DTWSlopeJ;
 };
 
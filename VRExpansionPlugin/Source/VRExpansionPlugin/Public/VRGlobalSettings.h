@@ -100,6 +100,20 @@ public:
 	UPROPERTY(config, BlueprintReadWrite, EditAnywhere, Category = "ChaosPhysics|CollisionIgnore")
 		float CollisionIgnoreSubsystemUpdateRate;
 
+	// If true the collision cleanup checks are driven by the tracked primitives losing their physics state, or a pair ending up empty
+	// Pairs are only re-checked when one of those happens instead of sweeping every pair at the rate above
+	UPROPERTY(config, BlueprintReadWrite, EditAnywhere, Category = "ChaosPhysics|CollisionIgnore")
+		bool bUseEventDrivenCollisionIgnoreChecks;
+
+	// If true each update bucket spreads its callbacks evenly over the frames in its period instead of firing them all at once
+	UPROPERTY(config, BlueprintReadWrite, EditAnywhere, Category = "BucketUpdates")
+		bool bSpreadBucketUpdatesOverPeriod;
+
+	// Max time in milliseconds to spend on spread bucket updates per frame, anything left over carries to the next frame
+	// 0 is unlimited, each bucket always gets at least one callback per frame when it has one due
+	UPROPERTY(config, BlueprintReadWrite, EditAnywhere, Category = "BucketUpdates", meta = (ClampMin = "0.0", UIMin = "0.0"))
+		float BucketUpdateBudgetMS;
+
 	// Whether we should use the physx to chaos translation scalers or not
 	// This should be off on native chaos projects that have been set with the correct stiffness and damping settings already
 	UPROPERTY(config, BlueprintReadWrite, EditAnywhere, Category = "ChaosPhysics")
@@ -170,6 +184,44 @@ public:
 	UPROPERTY(config, BlueprintReadWrite, EditAnywhere, Category = "HybridWithSweepLerp")
 		float HybridWithSweepLerpDuration;
 
+	// If true, sweep and hybrid with sweep grips queue their collision sweeps during the grip tick and resolve them
+	// all together in the end physics tick instead of sweeping inline. The results are applied on the next grip tick
+	// so collision state lags by a frame, but the sweeps are taken off of the pre physics path.
+	UPROPERTY(config, BlueprintReadWrite, EditAnywhere, Category = "GripSweeps")
+		bool bBatchGripSweepsInEndPhysics;
+
+	// If true, the grip interface flags, break distance and grip scripts of a grip are resolved once at grip time and cached instead of
+	// being queried every tick. Changing them on a held object (scripts added / removed / replicated in, or BP overrides of GetGripScripts
+	// or GripBreakDistance) then requires calling NotifyGripSettingsChanged on the controller to take effect.
+	UPROPERTY(config, BlueprintReadWrite, EditAnywhere, Category = "GripTick")
+		bool bCacheGripInterfaceValues;
+
+	// If true, controllers hand their grip tick to the grip tick subsystem, which runs it once every controller in the world has
+	// updated its tracking. Grips that only need the default transform (no grip scripts, secondary grips or lerping) have it
+	// solved for every controller at once before the rest of the grip logic runs.
+	// Gripped objects wait on the batched tick instead of only the controllers tick, requires a restart of play to take effect.
+	UPROPERTY(config, BlueprintReadWrite, EditAnywhere, Category = "GripTick")
+		bool bUseBatchedGripTick;
+
+	// How many batched grips there needs to be before the transforms are solved across task threads instead of inline
+	UPROPERTY(config, BlueprintReadWrite, EditAnywhere, Category = "GripTick", meta = (ClampMin = "1", UIMin = "1", EditCondition = "bUseBatchedGripTick"))
+		int32 BatchedGripTickParallelThreshold;
+
+	// If true, the server queues the moves received from VR characters and runs them all from one scheduled pass in pre physics
+	// instead of inline as the packets come in. Corrections are still sent from the net tick like normal.
+	// Requires a restart of play to take effect.
+	UPROPERTY(config, BlueprintReadWrite, EditAnywhere, Category = "ServerMoves")
+		bool bUseBatchedServerMoves;
+
+	// How long in milliseconds the batched server move pass can run each frame before leaving the remaining characters moves for the next frame
+	// 0 is unlimited
+	UPROPERTY(config, BlueprintReadWrite, EditAnywhere, Category = "ServerMoves", meta = (ClampMin = "0.0", UIMin = "0.0", EditCondition = "bUseBatchedServerMoves"))
+		float BatchedServerMoveTimeBudgetMS;
+
+	// How many frames a characters moves can be left over by the time budget before they are ran regardless of it
+	UPROPERTY(config, BlueprintReadWrite, EditAnywhere, Category = "ServerMoves", meta = (ClampMin = "0", UIMin = "0", EditCondition = "bUseBatchedServerMoves"))
+		int32 BatchedServerMoveMaxDeferredFrames;
+
 	UPROPERTY(config, BlueprintReadWrite, EditAnywhere, Category = "GlobalLerpToHand")
 		bool bUseGlobalLerpToHand;
 